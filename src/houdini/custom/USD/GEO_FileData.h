@@ -26,6 +26,7 @@
 #include "pxr/usd/sdf/abstractData.h"
 #include "pxr/usd/sdf/fileFormat.h"
 #include "pxr/base/tf/declarePtrs.h"
+#include <atomic>
 
 class GA_PrimitiveGroup;
 
@@ -51,7 +52,11 @@ public:
     /// Opens the Houdini geometry file at \p filePath read-only (closing any
     /// open file).  Houdini geometry is not meant to be used as an in-memory
     /// store for editing so methods that modify the file are not supported.
-    bool		 Open(const std::string& filePath);
+    /// If \p metadataOnly is true, only the pseudo-root and layer info prim
+    /// are guaranteed to be populated, which allows skipping the conversion
+    /// of the geometry (and sometimes loading it at all).
+    bool		 Open(const std::string& filePath,
+				bool metadataOnly = false);
 
     // We don't stream data from disk, but we must claim that we do or else
     // reloading layers of this format will try to do fine grained updates and
@@ -126,6 +131,11 @@ protected:
 
 private:
     const GEO_FilePrim	*getPrim(const SdfPath& id) const;
+    void		 countQuery(std::atomic<exint> &counter) const
+			 {
+			     if (myCollectStats)
+				 counter.fetch_add(1, std::memory_order_relaxed);
+			 }
 
     GEO_FilePrimMap			 myPrims;
     GEO_FilePrim			*myPseudoRoot;
@@ -135,6 +145,12 @@ private:
     bool				 mySampleFrameSet;
     bool				 mySaveSampleFrame;
 
+    // Statistics reported through the GEO_FILE_STATS debug code.
+    std::string				 myFilePath;
+    bool				 myCollectStats;
+    mutable std::atomic<exint>		 myFieldQueryCount;
+    mutable std::atomic<exint>		 myTimeSampleQueryCount;
+
     friend class GEO_FilePrim;
 };
 
@@ -33,6 +33,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 #define GEO_AGENT_PRIM_TOKENS  \
     ((agentdefinitions, "agentdefinitions")) \
     ((animation, "animation")) \
+    ((animations, "animations")) \
     ((geometry, "geometry")) \
     ((layers, "layers")) \
     ((skeleton,	"skeleton")) \
@@ -52,6 +53,35 @@ VtMatrix4dArray GEOconvertXformArray(const GU_AgentRig &rig,
                                      const GU_Agent::Matrix4Array &agent_xforms,
                                      const UT_Array<exint> &joint_order);
 
+/// The joint transforms and blendshape channel values of an agent, in the
+/// form required by a SkelAnimation prim.
+struct GEO_AgentPose : public UT_IntrusiveRefCounter<GEO_AgentPose>
+{
+    bool operator==(const GEO_AgentPose &other) const;
+    size_t hash() const;
+
+    VtTokenArray myJointPaths;
+    VtVec3fArray myTranslates;
+    VtQuatfArray myRotates;
+    VtVec3hArray myScales;
+    bool myHasXforms = false;
+
+    VtTokenArray myChannelNames;
+    VtFloatArray myChannelValues;
+    bool myHasChannels = false;
+};
+
+using GEO_AgentPosePtr = UT_IntrusivePtr<GEO_AgentPose>;
+using GEO_AgentPoseConstPtr = UT_IntrusivePtr<const GEO_AgentPose>;
+
+/// Compute the agent's current pose. The joint list should have been built
+/// from the agent's rig with GEObuildJointList(), and is shared with the
+/// returned pose.
+GEO_AgentPosePtr GEOcomputeAgentPose(const GU_Agent &agent,
+                                     const VtTokenArray &joint_paths,
+                                     const UT_Array<exint> &joint_order,
+                                     const VtTokenArray &channel_names);
+
 /// Tracks information about the source agent shape when refining an entry in
 /// the shape library.
 struct GEO_AgentShapeInfo : public UT_IntrusiveRefCounter<GEO_AgentShapeInfo>
@@ -166,6 +196,22 @@ public:
     const GU_Agent &getAgent() const { return *myAgent; }
     const SdfPath &getDefinitionPath() const { return myDefinitionPath; }
 
+    /// The agent's pose, if it was computed ahead of time by
+    /// GEOcomputeAgentPoses().
+    const GEO_AgentPoseConstPtr &getPose() const { return myPose; }
+    /// The SkelAnimation prim shared by all agents with an identical pose,
+    /// or an empty path if the agent should have its own animation prim.
+    const SdfPath &getSharedAnimationPath() const
+    {
+        return mySharedAnimationPath;
+    }
+    void setPose(const GEO_AgentPoseConstPtr &pose,
+                 const SdfPath &shared_animation_path = SdfPath())
+    {
+        myPose = pose;
+        mySharedAnimationPath = shared_animation_path;
+    }
+
     static int getStaticPrimitiveType();
 
     virtual int getPrimitiveType() const override
@@ -200,9 +246,18 @@ private:
     const GU_Agent *myAgent;
     SdfPath myDefinitionPath;
     GT_AttributeListHandle myAttributeList;
+    GEO_AgentPoseConstPtr myPose;
+    SdfPath mySharedAnimationPath;
     static int thePrimitiveType;
 };
 
+/// Compute the poses of the agents in parallel, ahead of converting them
+/// one at a time. If share_poses is true, agents of the same definition
+/// with identical poses are bound to a single SkelAnimation prim underneath
+/// the agent definition rather than each authoring their own.
+void GEOcomputeAgentPoses(const UT_Array<GT_PrimAgentInstance *> &agents,
+                          bool share_poses);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif
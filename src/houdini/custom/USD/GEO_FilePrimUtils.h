@@ -72,6 +72,7 @@ public:
     bool			 myReversePolygons = false;
     bool                         myDefineOnlyLeafPrims = false;
     bool                         myTranslateUVToST = true;
+    bool                         myShareAgentPoses = false;
 };
 
 void
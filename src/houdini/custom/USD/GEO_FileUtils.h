@@ -18,6 +18,7 @@
 #define __GEO_FILE_UTILS_H__
 
 #include "pxr/pxr.h"
+#include "pxr/base/tf/debug.h"
 #include "pxr/base/tf/staticTokens.h"
 #include <map>
 
@@ -26,6 +27,15 @@ PXR_NAMESPACE_OPEN_SCOPE
 class TfToken;
 class VtValue;
 
+// Enabling GEO_FILE_STATS (for example with TF_DEBUG=GEO_FILE_STATS) prints
+// one JSON object per line for every geometry file that is opened or closed,
+// with timings for each phase of the conversion, prim counts, memory usage
+// and the number of value queries. This is meant to be collected by scripts
+// that track conversion performance across builds.
+TF_DEBUG_CODES(
+    GEO_FILE_STATS
+);
+
 // Controls the handling of topology attributes. They can be written to time
 // samples to allow for animated topology. They can be written to the default
 // attribute value for static topology authoring. Or they can be skipped
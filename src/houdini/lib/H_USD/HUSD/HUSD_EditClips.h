@@ -27,7 +27,13 @@
 
 #include "HUSD_API.h"
 #include "HUSD_DataHandle.h"
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_StringArray.h>
 #include <UT/UT_StringHolder.h>
+#include <UT/UT_UniquePtr.h>
+
+class HUSD_TimeCode;
+class husd_ClipGeneratorPrivate;
 
 class HUSD_ClipSegment
 {
@@ -57,6 +63,52 @@ private:
 
 typedef UT_Array<HUSD_ClipSegment> HUSD_ClipSegmentArray;
 
+// Generates value clips from a sequence of time samples of a stage. Each
+// time sample is written to its own clip layer, holding only the values of
+// the time varying attributes under the clip prim. Captured samples are
+// written out in parallel batches, so at most max_pending_clips samples are
+// held in memory at once. The topology layer is built from the first sample,
+// and the manifest from the time varying attributes of all samples.
+class HUSD_API HUSD_ClipGenerator : public UT_NonCopyable
+{
+public:
+			 HUSD_ClipGenerator(const UT_StringRef &clipprimpath,
+				exint max_pending_clips = -1);
+			~HUSD_ClipGenerator();
+
+    // Captures the values of the stage at the given time, to be written to
+    // clipfile. Samples must be added in increasing time order.
+    bool		 addClip(const HUSD_AutoReadLock &lock,
+				const HUSD_TimeCode &timecode,
+				const UT_StringRef &clipfile);
+    // Writes any pending clips, then the topology and manifest layers.
+    // Either file name may be empty to skip writing that layer.
+    bool		 finish(const UT_StringRef &topologyfile,
+				const UT_StringRef &manifestfile);
+
+    const UT_StringHolder &clipPrimPath() const
+			 { return myClipPrimPath; }
+    const UT_StringArray &clipFiles() const
+			 { return myClipFiles; }
+    const UT_FprealArray &clipTimes() const
+			 { return myClipTimes; }
+    const UT_StringHolder &topologyFile() const
+			 { return myTopologyFile; }
+    const UT_StringHolder &manifestFile() const
+			 { return myManifestFile; }
+
+private:
+    bool		 writePendingClips();
+
+    UT_UniquePtr<husd_ClipGeneratorPrivate>	 myPrivate;
+    UT_StringHolder				 myClipPrimPath;
+    UT_StringArray				 myClipFiles;
+    UT_FprealArray				 myClipTimes;
+    UT_StringHolder				 myTopologyFile;
+    UT_StringHolder				 myManifestFile;
+    exint					 myMaxPendingClips;
+};
+
 class HUSD_API HUSD_EditClips
 {
 public:
@@ -79,6 +131,15 @@ public:
                                 fpreal cliptimescale,
                                 const HUSD_ClipSegmentArray &segments) const;
 
+    // Authors all the clip metadata for the clips written by a generator
+    // in a single change block: the clip prim path, asset paths, manifest,
+    // and one active clip per time sample. If reference_topology is true,
+    // the topology layer is also referenced onto the prim.
+    bool                 setClips(const UT_StringRef &primpath,
+                                const UT_StringRef &clipsetname,
+                                const HUSD_ClipGenerator &generator,
+                                bool reference_topology) const;
+
 private:
     HUSD_AutoWriteLock	&myWriteLock;
 };
@@ -29,6 +29,7 @@
 #include "HUSD_DataHandle.h"
 #include <UT/UT_StringMap.h>
 #include <UT/UT_ArrayStringSet.h>
+#include <UT/UT_UniquePtr.h>
 
 class HUSD_TimeCode;
 enum class HUSD_XformType;
@@ -37,6 +38,7 @@ template <typename T> class UT_BoundingBoxT;
 using UT_BoundingBoxD = UT_BoundingBoxT<fpreal64>;
 class UT_InfoTree;
 class UT_Options;
+class husd_InfoQueryCache;
 
 
 class HUSD_API HUSD_Info
@@ -53,6 +55,12 @@ public:
     static void          getUsdVersionInfo(UT_StringMap<UT_StringHolder> &info);
     static bool		 reload(const UT_StringRef &filepath, bool recursive);
 
+    // Reuse transform and bounds computations between the transform and
+    // bounds queries made through this object. This should only be enabled
+    // while the stage can't change, such as for the duration of a read lock
+    // held while cooking.
+    void		 setUseQueryCache(bool use_query_cache);
+
     bool		 isStageValid() const;
     bool		 getStageRootLayer(UT_StringHolder &identifier) const;
 
@@ -161,6 +169,21 @@ public:
     UT_Matrix4D		 getParentXform(const UT_StringRef &primpath,
 				const HUSD_TimeCode &time_code,
 				HUSD_TimeSampling *time_sampling=nullptr) const;
+
+    // Batched transform queries. The transforms of all the prims are
+    // computed in parallel, sharing the work for common ancestors, and are
+    // returned in the order of the paths. Prims that don't exist or aren't
+    // xformable get a zero matrix. Returns false if the stage is invalid.
+    bool		 getLocalXforms(const UT_StringArray &primpaths,
+				const HUSD_TimeCode &time_code,
+				UT_Array<UT_Matrix4D> &xforms) const;
+    bool		 getWorldXforms(const UT_StringArray &primpaths,
+				const HUSD_TimeCode &time_code,
+				UT_Array<UT_Matrix4D> &xforms) const;
+    bool		 getParentXforms(const UT_StringArray &primpaths,
+				const HUSD_TimeCode &time_code,
+				UT_Array<UT_Matrix4D> &xforms) const;
+
     bool		 getXformOrder(const UT_StringRef &primpath,
 				UT_StringArray &xform_order) const;
     bool		 isXformReset(const UT_StringRef &primpath ) const;
@@ -185,6 +208,12 @@ public:
     UT_BoundingBoxD	 getBounds(const UT_StringRef &primpath,
 				const UT_StringArray &purposes,
 				const HUSD_TimeCode &time_code) const;
+    // Batched bounds query, computed in parallel. Prims that don't exist get
+    // an invalid bounding box. Returns false if the stage is invalid.
+    bool		 getBounds(const UT_StringArray &primpaths,
+				const UT_StringArray &purposes,
+				const HUSD_TimeCode &time_code,
+				UT_Array<UT_BoundingBoxD> &bboxes) const;
 
     // Point Instancers
     bool		 getPointInstancerXforms( const UT_StringRef &primpath,
@@ -194,6 +223,11 @@ public:
 				exint instance_index,
 				const UT_StringArray &purposes,
 				const HUSD_TimeCode &time_code) const;
+    bool		 getPointInstancerBounds(const UT_StringRef &primpath,
+				const UT_Array<exint> &instance_indices,
+				const UT_StringArray &purposes,
+				const HUSD_TimeCode &time_code,
+				UT_Array<UT_BoundingBoxD> &bboxes) const;
 
     // Variants
     bool		 getVariantSets(const UT_StringRef &primpath,
@@ -291,7 +325,8 @@ public:
                                 UT_IntArray &fromsops) const;
 
 private:
-    HUSD_AutoAnyLock	*myAnyLock;
+    HUSD_AutoAnyLock			*myAnyLock;
+    UT_UniquePtr<husd_InfoQueryCache>	 myQueryCache;
 };
 
 #endif
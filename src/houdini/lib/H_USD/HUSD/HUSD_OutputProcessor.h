@@ -26,6 +26,7 @@
 #define __HUSD_OutputProcessor_h__
 
 #include "HUSD_API.h"
+#include <UT/UT_Array.h>
 #include <UT/UT_StringArray.h>
 #include <UT/UT_StringMap.h>
 #include <UT/UT_SharedPtr.h>
@@ -34,6 +35,32 @@ class UT_String;
 class OP_Node;
 class PI_EditScriptedParms;
 
+// ============================================================================ 
+/// The arguments and results of a single HUSD_OutputProcessor::processAsset()
+/// call, used to hand a batch of assets to HUSD_OutputProcessor::processAssets.
+///
+class HUSD_API HUSD_OutputProcessorAsset
+{
+public:
+                         HUSD_OutputProcessorAsset()
+                             : myAssetIsLayer(false),
+                               myForSave(false),
+                               mySuccess(false)
+                         { }
+
+    UT_StringHolder      myAssetPath;
+    UT_StringHolder      myAssetPathForSave;
+    UT_StringHolder      myReferencingLayerPath;
+    bool                 myAssetIsLayer;
+    bool                 myForSave;
+
+    // Set by the processor.
+    UT_StringHolder      myNewPath;
+    UT_StringHolder      myError;
+    bool                 mySuccess;
+};
+typedef UT_Array<HUSD_OutputProcessorAsset> HUSD_OutputProcessorAssetArray;
+
 // ============================================================================ 
 /// Performs processing on a USD output path during a save operation.
 ///
@@ -54,6 +81,18 @@ public:
                                 UT_String &newpath,
                                 UT_String &error) = 0;
 
+    /// Processes a batch of unrelated assets. The default implementation
+    /// calls processAsset() for each asset, from several threads at once if
+    /// isThreadSafe() returns true. Subclasses with a high per-call overhead
+    /// can override this to handle the whole batch in one go.
+    virtual void         processAssets(
+                                HUSD_OutputProcessorAssetArray &assets);
+
+    /// Returns true if processAsset() can be called from multiple threads
+    /// at the same time.
+    virtual bool         isThreadSafe() const
+                         { return false; }
+
     virtual const UT_StringHolder       &displayName() const = 0;
     virtual const PI_EditScriptedParms  *parameters() const = 0;
 
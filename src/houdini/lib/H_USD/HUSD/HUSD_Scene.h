@@ -34,12 +34,15 @@
 #include <UT/UT_LinkList.h>
 #include <UT/UT_Map.h>
 #include <UT/UT_NonCopyable.h>
+#include <UT/UT_SharedPtr.h>
 #include <UT/UT_Pair.h>
 #include <UT/UT_StringArray.h>
 #include <UT/UT_StringMap.h>
 #include <UT/UT_StringSet.h>
 #include <UT/UT_IntrusivePtr.h>
+#include <UT/UT_UniquePtr.h>
 #include <UT/UT_Vector2.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <SYS/SYS_Types.h>
 #include "HUSD_PrimHandle.h"
 #include "HUSD_Overrides.h"
@@ -56,6 +59,9 @@ class HUSD_HydraLight;
 class HUSD_HydraPrim;
 class HUSD_HydraMaterial;
 class HUSD_DataHandle;
+class husd_SelectionIndex;
+class husd_SelectionIndexCache;
+typedef UT_SharedPtr<const husd_SelectionIndex> husd_SelectionIndexPtr;
 
 typedef UT_IntrusivePtr<HUSD_HydraGeoPrim>  HUSD_HydraGeoPrimPtr;
 typedef UT_IntrusivePtr<HUSD_HydraCamera>   HUSD_HydraCameraPtr;
@@ -241,11 +247,21 @@ protected:
     bool         makeSelection(const UT_Map<int,int> &selection,
                                bool validate);
 
+    // Indices of mySelection and myHighlight, rebuilt when the selection or
+    // highlight ID changes, or when a selected ID is given a new name.
+    husd_SelectionIndexPtr selectionIndex() const;
+    husd_SelectionIndexPtr highlightIndex() const;
+    void	 nameIDChanged(int id);
+
     int          getIDForPrim(const UT_StringRef &path,
                               PrimType &return_prim_type,
                               bool create_path_id = false);
   
     UT_Map<int, UT_Pair<UT_StringHolder, PrimType> >	myNameIDLookup;
+    // Bumped whenever the name of a selected or highlighted ID changes.
+    // Entries are added and removed under different locks, so this is
+    // atomic.
+    SYS_AtomicInt64			myNameIDSerial;
     UT_StringMap<int>			myPathIDs;
     UT_StringMap<UT_StringSet>		myFieldsInVolumes;
     UT_StringMap<HUSD_HydraGeoPrimPtr>	myGeometry;
@@ -283,6 +299,9 @@ protected:
     UT_StringMap<int>                   myLightLinkCategories;
     UT_StringMap<int>                   myShadowLinkCategories;
 
+    UT_UniquePtr<husd_SelectionIndexCache> mySelectionIndex;
+    UT_UniquePtr<husd_SelectionIndexCache> myHighlightIndex;
+
     UT_LinkList                         myStashedSelection;
     int64                               myStashedSelectionSizeB;
     UT_LinkNode                        *myCurrentRecalledSelection;
@@ -21,6 +21,7 @@
 
 #include <GU/GU_AgentRig.h>
 #include <SYS/SYS_Types.h>
+#include <UT/UT_Array.h>
 
 class GU_AgentClip;
 class GU_AgentLayer;
@@ -60,6 +61,18 @@ HUSDimportSkeletonPose(GU_Detail &gdp, const HUSD_AutoReadLock &readlock,
                        const UT_StringRef &skelrootpath,
                        HUSD_SkeletonPoseType pose_type, fpreal time);
 
+/// Batched version of HUSDimportSkeletonPose(), which evaluates the pose at
+/// each of the provided times and writes it to the corresponding detail. Each
+/// detail must contain the skeleton geometry created by HUSDimportSkeleton().
+/// The skeleton queries are built once and shared between all of the samples,
+/// which are evaluated in parallel.
+HUSD_API bool
+HUSDimportSkeletonPoses(const UT_Array<GU_Detail *> &gdps,
+                        const HUSD_AutoReadLock &readlock,
+                        const UT_StringRef &skelrootpath,
+                        HUSD_SkeletonPoseType pose_type,
+                        const UT_FprealArray &times);
+
 /// Builds an agent rig from the SkelRoot's first Skeleton prim.
 HUSD_API GU_AgentRigPtr
 HUSDimportAgentRig(const HUSD_AutoReadLock &readlock,
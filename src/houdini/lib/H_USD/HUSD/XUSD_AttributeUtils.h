@@ -102,6 +102,14 @@ template<typename UT_VALUE_TYPE>
 HUSD_API VtValue
 HUSDgetVtValue( const UT_VALUE_TYPE &ut_value );
 
+/// Conversion function from UT_* value objects to a VtValue holding the
+/// value type of the given USD type name, using the same conversions as
+/// HUSDsetAttribute(). Returns an empty VtValue if there is no conversion.
+/// Used for authoring values directly into SdfAttributeSpecs.
+template<typename UT_VALUE_TYPE>
+HUSD_API VtValue
+HUSDgetVtValue( const UT_VALUE_TYPE &ut_value, const SdfValueTypeName &type );
+
 
 /// Returns the type of a shader input attribute given the VOP node input.
 HUSD_API SdfValueTypeName   HUSDgetShaderAttribSdfTypeName( 
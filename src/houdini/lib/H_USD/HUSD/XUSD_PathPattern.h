@@ -27,6 +27,7 @@
 
 #include "HUSD_API.h"
 #include "HUSD_PathPattern.h"
+#include "XUSD_PathSet.h"
 #include <pxr/usd/sdf/path.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -39,9 +40,9 @@ public:
     virtual	~XUSD_SpecialTokenData()
 		 { }
 
-    SdfPathSet	 myExpandedCollectionPathSet;
-    SdfPathSet	 myCollectionPathSet;
-    SdfPathSet	 myVexpressionPathSet;
+    XUSD_PathSet myExpandedCollectionPathSet;
+    XUSD_PathSet myCollectionPathSet;
+    XUSD_PathSet myVexpressionPathSet;
 };
 
 class HUSD_API XUSD_PathPattern : public HUSD_PathPattern
@@ -57,9 +58,9 @@ public:
 				const HUSD_TimeCode &timecode);
 			~XUSD_PathPattern();
 
-    void		 getSpecialTokenPaths(SdfPathSet &collection_paths,
-				SdfPathSet &expanded_collection_paths,
-				SdfPathSet &vexpression_paths) const;
+    void		 getSpecialTokenPaths(XUSD_PathSet &collection_paths,
+				XUSD_PathSet &expanded_collection_paths,
+				XUSD_PathSet &vexpression_paths) const;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -35,6 +35,25 @@ class HUSD_API XUSD_PathSet : public SdfPathSet
 public:
 			 XUSD_PathSet();
 			~XUSD_PathSet();
+
+    /// Adds all paths from a sorted vector. Each new path is inserted using
+    /// the previous one as a hint, so this is linear in the number of paths
+    /// instead of requiring a full search of the set for each one.
+    void		 insertSorted(const SdfPathVector &sorted_paths);
+    /// Sorts the paths (in parallel), removes duplicates, and adds them.
+    /// The contents of the paths vector are modified by this call.
+    void		 insertUnsorted(SdfPathVector &paths);
+    /// Adds all paths from another set, merging the two sorted sequences.
+    void		 insertSet(const SdfPathSet &paths);
+
+    /// Adds all ancestors of the path, up to and including the absolute
+    /// root path. Stops as soon as it finds an ancestor that is already in
+    /// the set, because this method adds full ancestor chains, so all the
+    /// ancestors of that path should already be in the set too.
+    void		 insertAncestors(const SdfPath &path);
+
+    /// Returns true if the path or any of its ancestors is in the set.
+    bool		 containsPathOrAncestor(const SdfPath &path) const;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
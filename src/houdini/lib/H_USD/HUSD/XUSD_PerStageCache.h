@@ -0,0 +1,148 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+
+#ifndef __XUSD_PerStageCache_h__
+#define __XUSD_PerStageCache_h__
+
+#include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_NonCopyable.h>
+#include <pxr/pxr.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <memory>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// Returns true if an ObjectsChanged notice may have added, removed, or
+// changed the metadata of any prims. Info changes to properties only count
+// if a property_prefix is given and the property name starts with it.
+inline bool
+XUSDnoticeChangesPrims(const UsdNotice::ObjectsChanged &notice,
+	const char *property_prefix = nullptr)
+{
+    if (!notice.GetResyncedPaths().empty())
+	return true;
+
+    for (auto &&path : notice.GetChangedInfoOnlyPaths())
+    {
+	if (!path.IsPropertyPath() ||
+	    (property_prefix &&
+	     TfStringStartsWith(path.GetName(), property_prefix)))
+	    return true;
+    }
+
+    return false;
+}
+
+// Holds a DataT computed from a single stage. Whenever the stage sends an
+// ObjectsChanged notice for which DataT::isDirtiedBy() returns true, the
+// data is thrown away and replaced with a default constructed DataT. Caches
+// are shared by everyone asking for the same DataT on the same stage.
+template <typename DataT>
+class XUSD_PerStageCache : public TfWeakBase, UT_NonCopyable
+{
+public:
+    typedef std::shared_ptr<XUSD_PerStageCache<DataT>> Ptr;
+
+		 XUSD_PerStageCache(const UsdStageRefPtr &stage)
+		    : myStage(stage)
+		 {
+		    myNoticeKey = TfNotice::Register(TfCreateWeakPtr(this),
+			&XUSD_PerStageCache::handleObjectsChanged, myStage);
+		 }
+		~XUSD_PerStageCache()
+		 {
+		    TfNotice::Revoke(myNoticeKey);
+		 }
+
+    // Returns the cache for the stage, creating it if needed.
+    static Ptr	 get(const UsdStageRefPtr &stage)
+		 {
+		    static UT_Lock			 theCachesLock;
+		    static UT_Map<const UsdStage *, Ptr> theCaches;
+
+		    UT_AutoLock lock(theCachesLock);
+		    auto it = theCaches.find(get_pointer(stage));
+
+		    // A stage may have been destroyed and another created at
+		    // the same address, so an expired entry is never reused.
+		    if (it != theCaches.end() && !it->second->isExpired())
+			return it->second;
+
+		    for (auto oldit = theCaches.begin();
+			 oldit != theCaches.end(); )
+		    {
+			if (oldit->second->isExpired())
+			    oldit = theCaches.erase(oldit);
+			else
+			    ++oldit;
+		    }
+
+		    Ptr cache(new XUSD_PerStageCache(stage));
+
+		    theCaches[get_pointer(stage)] = cache;
+
+		    return cache;
+		 }
+
+    bool	 isExpired() const
+		 { return !myStage; }
+
+    // Calls func with the cached data while holding the cache lock, and
+    // returns whatever func returns.
+    template <typename FuncT>
+    auto	 access(const FuncT &func)
+		    -> decltype(func(std::declval<DataT &>()))
+		 {
+		    UT_AutoLock lock(myLock);
+
+		    return func(myData);
+		 }
+
+private:
+    void	 handleObjectsChanged(const UsdNotice::ObjectsChanged &notice)
+		 {
+		    if (DataT::isDirtiedBy(notice))
+		    {
+			UT_AutoLock lock(myLock);
+
+			myData = DataT();
+		    }
+		 }
+
+    UsdStageWeakPtr	 myStage;
+    TfNotice::Key	 myNoticeKey;
+    UT_Lock		 myLock;
+    DataT		 myData;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -32,6 +32,7 @@
 #include "UT_Gf.h"
 
 #include "pxr/usd/usdGeom/boundable.h"
+#include "pxr/usd/usdGeom/gprim.h"
 #include "pxr/usd/usdGeom/xformable.h"
 
 #include <GT/GT_CatPolygonMesh.h>
@@ -212,6 +213,19 @@ namespace {
 
     typedef GusdUT_CappedKey<CacheKeyValue, CacheKeyValue::HashCmp> CacheKey;
 
+    // Records whether any attribute of a gprim might vary over time.
+    struct TimeInfo : public UT_CappedItem {
+        TimeInfo( bool timeVarying ) : timeVarying( timeVarying ) {}
+
+        virtual int64   getMemoryUsage () const { return sizeof(*this); }
+
+        bool timeVarying;
+    };
+
+    typedef GusdUT_CappedKey<GusdUSD_UnvaryingPropertyKey,
+                             GusdUSD_UnvaryingPropertyKey::HashCmp>
+        TimeInfoKey;
+
 }; // end namespace 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -227,7 +241,8 @@ GusdGT_PrimCache::GetInstance()
 ////////////////////////////////////////////////////////////////////////////////
 
 GusdGT_PrimCache::GusdGT_PrimCache() : 
-    _prims( "GusdGT_PrimCache", 1024 )
+    _prims( "GusdGT_PrimCache", 1024 ),
+    _timeInfos( "GusdGT_PrimCache Time Info", 8 )
 {
 }
 
@@ -247,6 +262,17 @@ GusdGT_PrimCache::GetPrim( const UsdPrim &usdPrim,
         return GT_PrimitiveHandle();
     }
 
+    // Gprims whose attributes are all unvarying refine to the same GT prim
+    // at every time, so key them on a single time code. This lets playback
+    // of static geometry share one refined prim rather than storing a copy
+    // for every frame. Default time is kept separate since it may resolve
+    // to a different value than the time samples.
+    if( !time.IsDefault() && _IsTimeInvariant( usdPrim )) {
+        time = UsdTimeCode::EarliestTime();
+    }
+
+    _MaybeDumpStats();
+
     CacheKey key(CacheKeyValue(usdPrim, time, purposes));
 
     CreateEntryFn createFunc(*this);
@@ -257,15 +283,60 @@ GusdGT_PrimCache::GetPrim( const UsdPrim &usdPrim,
     return entry ? entry->prim : NULL;    
 }
 
+bool
+GusdGT_PrimCache::_IsTimeInvariant( const UsdPrim &usdPrim )
+{
+    // Only plain gprims are considered. Instances and groups depend on the
+    // transforms of other prims, and point instancers on their prototypes.
+    if( usdPrim.IsInstance() || usdPrim.IsInstanceProxy() ||
+        !usdPrim.IsA<UsdGeomGprim>() ) {
+        return false;
+    }
+
+    TimeInfoKey key((GusdUSD_UnvaryingPropertyKey(usdPrim)));
+    if( auto info = _timeInfos.Find<TimeInfo>( key )) {
+        return !info->timeVarying;
+    }
+
+    // XXX: Potential race in construction, but in the worst case that will
+    // just mean a few extra computes.
+    bool timeVarying = false;
+    for( const UsdAttribute &attr : usdPrim.GetAttributes() ) {
+        if( attr.ValueMightBeTimeVarying() ) {
+            timeVarying = true;
+            break;
+        }
+    }
+    _timeInfos.AddItem( key, UT_CappedItemHandle( new TimeInfo( timeVarying )));
+
+    return !timeVarying;
+}
+
 void
 GusdGT_PrimCache::Clear()
 {
-    _prims.clear();
+    _prims.Clear();
+    _timeInfos.Clear();
+}
+
+void
+GusdGT_PrimCache::_AccumulateStats(GusdUSD_DataCacheStats& stats) const
+{
+    GusdUSD_DataCache::_AccumulateStats(_prims, stats);
+    GusdUSD_DataCache::_AccumulateStats(_timeInfos, stats);
 }
 
 int64
 GusdGT_PrimCache::Clear(const UT_StringSet& paths)
 {
+    _timeInfos.ClearEntries(
+        [&](const UT_CappedKeyHandle& key,
+            const UT_CappedItemHandle& item) {
+
+        return GusdUSD_DataCache::ShouldClearPrim(
+            (*UTverify_cast<const TimeInfoKey*>(key.get()))->prim, paths);
+    });
+
     return _prims.ClearEntries(
         [&](const UT_CappedKeyHandle& key,
             const UT_CappedItemHandle& item) {
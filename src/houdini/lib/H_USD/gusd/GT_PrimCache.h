@@ -62,9 +62,22 @@ public:
     virtual void    Clear() override;
     virtual int64   Clear(const UT_StringSet& paths) override;
 
+    virtual const char* GetName() const override
+                        { return "GusdGT_PrimCache"; }
+
+protected:
+    virtual void    _AccumulateStats(
+                        GusdUSD_DataCacheStats& stats) const override;
+
 private:
 
+    /// Returns true if refining @a usdPrim produces the same result at every
+    /// (non-default) time, so that a single cache entry can be shared by all
+    /// time samples. The result is cached per prim.
+    bool        _IsTimeInvariant( const UsdPrim &usdPrim );
+
     GusdUT_CappedCache _prims;
+    GusdUT_CappedCache _timeInfos;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
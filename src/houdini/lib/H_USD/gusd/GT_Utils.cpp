@@ -22,6 +22,7 @@
 // language governing permissions and limitations under the Apache License.
 //
 #include "GT_Utils.h"
+#include "GT_VtArray.h"
 #include "UT_Gf.h"
 #include "UT_Version.h"
 
@@ -31,6 +32,9 @@
 #include <GT/GT_PrimInstance.h>
 #include <GT/GT_Util.h>
 #include <SYS/SYS_Version.h>
+#include <UT/UT_ParallelUtil.h>
+#include <UT/UT_StackBuffer.h>
+#include <UT/UT_StringMap.h>
 
 #include "pxr/base/gf/vec3h.h"
 #include "pxr/base/gf/vec4h.h"
@@ -43,6 +47,7 @@
 
 #include BOOST_HEADER(tuple/tuple.hpp)
 
+#include <atomic>
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -286,6 +291,25 @@ struct GtDataToUsdTypename
 //#############################################################################
 
 
+/// Arrays with fewer entries than this are converted on the calling thread,
+/// since below this size the cost of spawning tasks outweighs the copy.
+const GT_Size _PARALLEL_MIN_ENTRIES = 16384;
+
+
+/// Invoke \p body over the range [0, \p count), splitting it into chunks
+/// that are processed in parallel when the range is large enough.
+template <typename Body>
+void
+_ForEachChunk(GT_Size count, const Body& body)
+{
+    if (count >= _PARALLEL_MIN_ENTRIES) {
+        UTparallelForLightItems(UT_BlockedRange<GT_Size>(0, count), body);
+    } else if (count > 0) {
+        body(UT_BlockedRange<GT_Size>(0, count));
+    }
+}
+
+
 /// Copy \p count elements from \p src to \p dst.
 template <typename FROM, typename TO>
 void
@@ -334,9 +358,22 @@ struct _ConvertNumericToUsd
         if (_IsNumeric(gtData->getStorage()) &&
             gtData->getTupleSize() == tupleSize) {
 
-            usdArray.resize(gtData->entries());
+            // Arrays read from USD and passed through unmodified already
+            // hold a VtArray of the right type, which can be shared as-is.
+            if (const auto* vtData = dynamic_cast<
+                    const GusdGT_VtArray<UsdType>*>(gtData.get())) {
+                usdArray = **vtData;
+                return true;
+            }
+
+            const GT_Size numElems = gtData->entries();
+            usdArray.resize(numElems);
             auto* dst = reinterpret_cast<ScalarType*>(usdArray.data());
-            gtData->fillArray(dst, 0, gtData->entries(), tupleSize);
+            _ForEachChunk(numElems, [&](const UT_BlockedRange<GT_Size>& r)
+            {
+                gtData->fillArray(dst + r.begin()*tupleSize,
+                                  r.begin(), r.size(), tupleSize);
+            });
             return true;
         }
         return false;
@@ -427,10 +464,16 @@ private:
     {
         const GT_Size numElems = gtData->entries();
         usdArray.resize(numElems);
-        auto dst = TfMakeSpan(usdArray);
-        for (GT_Offset i = 0; i < numElems; ++i) {
-            _fillValue<GtType>(dst[i], gtData, i);
-        }
+        auto* dst = reinterpret_cast<ScalarType*>(usdArray.data());
+        _ForEachChunk(numElems, [&](const UT_BlockedRange<GT_Size>& r)
+        {
+            // Fetch the whole chunk with one virtual call, then cast it
+            // with a tight loop rather than importing element by element.
+            const GT_Size count = r.size()*tupleSize;
+            UT_StackBuffer<GtType> src(count);
+            gtData->fillArray(src.array(), r.begin(), r.size(), tupleSize);
+            _CopyArray(dst + r.begin()*tupleSize, src.array(), count);
+        });
         return true;
     }
 };
@@ -463,11 +506,17 @@ struct _ConvertQuatToUsd
 
         if (GTisFloat(gtData->getStorage()) && gtData->getTupleSize() == 4) {
 
-            usdArray.resize(gtData->entries());
+            const GT_Size numElems = gtData->entries();
+            usdArray.resize(numElems);
             auto dst = TfMakeSpan(usdArray);
-            for (GT_Offset i = 0; i < gtData->entries(); ++i) {
-                _fillValue(dst[i], gtData, i);
-            }
+            _ForEachChunk(numElems, [&](const UT_BlockedRange<GT_Size>& r)
+            {
+                UT_StackBuffer<GtScalarType> src(r.size()*4);
+                gtData->fillArray(src.array(), r.begin(), r.size(), 4);
+                for (GT_Size i = 0; i < r.size(); ++i) {
+                    _setValue(dst[r.begin() + i], src.array() + i*4);
+                }
+            });
             return true;
         }
         return false;
@@ -480,7 +529,11 @@ private:
     {
         GtScalarType src[4];
         gtData->import(offset, src, 4);
-        
+        _setValue(usdValue, src);
+    }
+
+    static void _setValue(UsdType& usdValue, const GtScalarType* src)
+    {
         // Houdini quaternions are stored as i,j,k,w
         using UsdScalarType = typename UsdType::ScalarType;
 
@@ -535,8 +588,21 @@ struct _ConvertStringToUsd
         if (GTisString(gtData->getStorage()) &&
             gtData->getTupleSize() == 1) {
             // XXX tuples of strings not supported
-            usdArray.resize(gtData->entries());
-            gtData->fillStrings(usdArray.data());
+            const GT_Size numElems = gtData->entries();
+            usdArray.resize(numElems);
+            if (numElems < _PARALLEL_MIN_ENTRIES) {
+                gtData->fillStrings(usdArray.data());
+                return true;
+            }
+
+            auto dst = TfMakeSpan(usdArray);
+            UTparallelForLightItems(UT_BlockedRange<GT_Size>(0, numElems),
+                [&](const UT_BlockedRange<GT_Size>& r)
+                {
+                    for (GT_Size i = r.begin(); i < r.end(); ++i) {
+                        _ConvertString(gtData->getS(i), &dst[i]);
+                    }
+                });
             return true;
         }
         return false;
@@ -576,9 +642,12 @@ struct _ConvertStringLikeToUsd
             usdArray.resize(numElems);
 
             auto dst = TfMakeSpan(usdArray);
-            for (GT_Size i = 0; i < numElems; ++i) {
-                _ConvertString(gtData->getS(i), &dst[i]);
-            }
+            _ForEachChunk(numElems, [&](const UT_BlockedRange<GT_Size>& r)
+            {
+                for (GT_Size i = r.begin(); i < r.end(); ++i) {
+                    _ConvertString(gtData->getS(i), &dst[i]);
+                }
+            });
             return true;
         }
         return false;
@@ -1009,24 +1078,105 @@ GusdGT_Utils::setPrimvarSample(
     return setPvSample(usdPrim, name, data, interpolation, time);
 }
 
+bool
+GusdGT_Utils::canWriteIndexedPrimvar(
+    const UsdGeomImageable& usdPrim,
+    const TfToken &name,
+    const GT_DataArrayHandle& data,
+    const TfToken& interpolation )
+{
+    if( !data ||
+        interpolation == UsdGeomTokens->constant ||
+        data->getStorage() != GT_STORE_STRING ||
+        data->getTupleSize() != 1 ) {
+        return false;
+    }
+
+    // We can't change the type of an existing primvar.
+    const UsdGeomPrimvar existingPrimvar = usdPrim.GetPrimvar( name );
+    return !existingPrimvar ||
+        existingPrimvar.GetTypeName() == SdfValueTypeNames->StringArray;
+}
+
+bool
+GusdGT_Utils::setIndexedPrimvarSample( 
+    const UsdGeomImageable& usdPrim, 
+    const TfToken &name, 
+    const GT_DataArrayHandle& data, 
+    const TfToken& interpolation,
+    UsdTimeCode time )
+{
+    DBG(cerr << "GusdGT_Utils::setIndexedPrimvarSample: " << name
+             << ", " << GTstorage( data->getStorage() ) << ", "
+              << data->getTupleSize() << ", " << interpolation << endl);
+
+    const GT_Size entries = data->entries();
+    VtStringArray values;
+    VtIntArray indices( entries );
+
+    const GT_Size stringIndexCount = data->getStringIndexCount();
+    if( stringIndexCount >= 0 ) {
+        // The data is already indexed (eg. GT_DAIndexedString), so map
+        // its string indices to a compact list of the ones actually used.
+        UT_IntArray remap;
+        remap.setSizeNoInit( stringIndexCount );
+        remap.constant( -1 );
+
+        for( GT_Size i = 0; i < entries; ++i ) {
+            const GT_Offset si = data->getStringIndex( i );
+            int idx;
+            if( si >= 0 && si < stringIndexCount ) {
+                idx = remap(si);
+                if( idx < 0 ) {
+                    idx = remap(si) = values.size();
+                    values.push_back( data->getS( i ).toStdString() );
+                }
+            } else {
+                idx = values.size();
+                values.push_back( data->getS( i ).toStdString() );
+            }
+            indices[i] = idx;
+        }
+    } else {
+        UT_StringMap<int> valueIndices;
+
+        for( GT_Size i = 0; i < entries; ++i ) {
+            const UT_StringHolder value( data->getS( i ));
+            auto it = valueIndices.find( value );
+            if( it == valueIndices.end() ) {
+                it = valueIndices.emplace( value, int(values.size()) ).first;
+                values.push_back( value.toStdString() );
+            }
+            indices[i] = it->second;
+        }
+    }
+
+    UsdGeomPrimvar primvar = usdPrim.CreatePrimvar(
+        name, SdfValueTypeNames->StringArray, interpolation );
+    if( !primvar )
+        return false;
+
+    return primvar.Set( values, time ) && primvar.SetIndices( indices, time );
+}
+
 template <typename T> bool
-isDataConst( const T* p, GT_Size entries, GT_Size tupleSize ) {
+matchesFirstElement( const T* first, const T* p,
+                     GT_Size count, GT_Size tupleSize ) {
 
     if( tupleSize == 1 ) {
-        T first = *p++;
-        for( GT_Size i = 1; i < entries; ++i ) {
-            if( *p++ != first ) {
+        const T first_0 = *first;
+        for( GT_Size i = 0; i < count; ++i ) {
+            if( *p++ != first_0 ) {
                 return false;
             }
         }
         return true;
     }
     else if ( tupleSize == 3 ) {
-        T first_0 = *(p+0);
-        T first_1 = *(p+1);
-        T first_2 = *(p+2);
-        p += 3;
-        for( GT_Size i = 1; i < entries; ++i ) {
+        const T first_0 = *(first+0);
+        const T first_1 = *(first+1);
+        const T first_2 = *(first+2);
+        for( GT_Size i = 0; i < count; ++i ) {
             if( *(p+0) != first_0  ||
                 *(p+1) != first_1  ||
                 *(p+2) != first_2 ) {
@@ -1037,11 +1187,9 @@ isDataConst( const T* p, GT_Size entries, GT_Size tupleSize ) {
         return true;
     }
     else {
-        const T* firstP = p;
-        p += tupleSize;
-        for( GT_Size i = 1; i < entries; ++i ) {
+        for( GT_Size i = 0; i < count; ++i ) {
             for( GT_Size j = 0; j < tupleSize; ++ j ) {
-                if( *(p + j) != *(firstP + j) ) {
+                if( *(p + j) != *(first + j) ) {
                     return false;
                 }
             }
@@ -1051,6 +1199,29 @@ isDataConst( const T* p, GT_Size entries, GT_Size tupleSize ) {
     }
 }
 
+template <typename T> bool
+isDataConst( const T* p, GT_Size entries, GT_Size tupleSize ) {
+
+    if( entries < _PARALLEL_MIN_ENTRIES ) {
+        return matchesFirstElement( p, p + tupleSize, entries - 1, tupleSize );
+    }
+
+    // Compare chunks in parallel. Once any chunk finds a differing element
+    // the remaining chunks bail out without scanning.
+    std::atomic_bool differs( false );
+    UTparallelForLightItems( UT_BlockedRange<GT_Size>( 1, entries ),
+        [&]( const UT_BlockedRange<GT_Size>& r )
+        {
+            if( differs.load( std::memory_order_relaxed ))
+                return;
+            if( !matchesFirstElement( p, p + r.begin() * tupleSize,
+                                      r.size(), tupleSize )) {
+                differs.store( true, std::memory_order_relaxed );
+            }
+        });
+    return !differs;
+}
+
 bool 
 GusdGT_Utils::
 isDataConstant( const GT_DataArrayHandle& data )
@@ -1109,13 +1280,7 @@ isDataConstant( const GT_DataArrayHandle& data )
             GT_DataArrayHandle buffer;
             const int32* indices = data->getI32Array(buffer);
             if (indices ) {
-                int32 first = indices[0];
-                for (GT_Size i = 1; i < entries; ++i) {
-                    if (indices[i] != first) {
-                        return false;
-                    }
-                }
-                return true;
+                return isDataConst<int32>(indices, entries, 1);
             }
         }
 
@@ -1258,9 +1423,12 @@ transformPoints(
     GT_DataArrayHandle buffer;
     const UT_Vector3F* srcP = 
         reinterpret_cast<const UT_Vector3F *>(pts->getF32Array( buffer ));
-    for( GT_Size i = 0; i < pts->entries(); ++i ) {
-        *dstP++ = *srcP++ * objXform;
-    }
+    _ForEachChunk( pts->entries(), [&]( const UT_BlockedRange<GT_Size>& r )
+    {
+        for( GT_Size i = r.begin(); i < r.end(); ++i ) {
+            dstP[i] = srcP[i] * objXform;
+        }
+    });
     return newPts;
 }
 
@@ -121,6 +121,23 @@ public:
                                   const TfToken& interpolation,
                                   UsdTimeCode time );
 
+    /// Returns true if @a data can be written as an indexed primvar by
+    /// setIndexedPrimvarSample(). Only non-constant string primvars with
+    /// a tuple size of one are written indexed.
+    static bool canWriteIndexedPrimvar( const UsdGeomImageable& usdPrim,
+                                        const TfToken &name,
+                                        const GT_DataArrayHandle& data,
+                                        const TfToken& interpolation );
+
+    /// Write @a data as an indexed primvar, storing each unique value once
+    /// along with an array of indices. Callers should check
+    /// canWriteIndexedPrimvar() first.
+    static bool setIndexedPrimvarSample( const UsdGeomImageable& usdPrim,
+                                         const TfToken &name,
+                                         const GT_DataArrayHandle& data,
+                                         const TfToken& interpolation,
+                                         UsdTimeCode time );
+
     static bool isDataConstant( const GT_DataArrayHandle& data );
 
     static void setCustomAttributesFromGTPrim(
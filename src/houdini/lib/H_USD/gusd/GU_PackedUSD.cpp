@@ -31,6 +31,7 @@
 #include "primWrapper.h"
 
 #include "UT_Gf.h"
+#include "error.h"
 #include "GU_USD.h"
 #include "stageEdit.h"
 
@@ -63,11 +64,16 @@
 #include <GT/GT_RefineParms.h>
 #include <GT/GT_TransformArray.h>
 #include <GT/GT_Util.h>
+#include <GU/GU_MergeUtils.h>
 #include <GU/GU_PackedFactory.h>
 #include <GU/GU_PrimPacked.h>
 #include <UT/UT_DMatrix4.h>
+#include <UT/UT_Interrupt.h>
 #include <UT/UT_Map.h>
+#include <UT/UT_ParallelUtil.h>
+#include <UT/UT_Thread.h>
 
+#include <atomic>
 #include <mutex>
 #include <iostream>
 
@@ -961,7 +967,9 @@ GusdGU_PackedUSD::unpackGeometry(
 
     if( !usdPrim )
     {
-        TF_WARN( "Invalid prim found" );
+        // Post through the UT error manager rather than TF_WARN, so that
+        // unpackGeometries() can transport it from its worker threads.
+        GUSD_WARN().Msg( "Invalid prim found: %s", m_primPath.GetText() );
         return false;
     }
 
@@ -985,6 +993,121 @@ GusdGU_PackedUSD::unpackGeometry(
         UsdGeomImageable( usdPrim ), m_primPath, *transform, rparms );
 }
 
+/* static */
+bool
+GusdGU_PackedUSD::unpackGeometries(
+    GU_Detail &destgdp
+    , const UT_Array<const GU_PrimPacked *> &prims
+    , const char* primvarPattern
+    , bool translateSTtoUV
+    , const UT_StringRef& nonTransformingPrimvarPattern
+    , UT_Array<exint> &primCounts
+    , const GT_RefineParms *refineParms
+)
+{
+    UT_AutoInterrupt task("Unpacking USD packed prims");
+
+    const exint numPrims = prims.size();
+    primCounts.setSize(numPrims);
+    primCounts.zero();
+    if (numPrims == 0)
+        return true;
+
+    // Split the prims into contiguous chunks, each of which is unpacked into
+    // its own detail. Using contiguous chunks (rather than one detail per
+    // worker thread) keeps the merged result in the same order as the
+    // input prims. A few chunks per processor gives the scheduler room to
+    // balance prims with very different refinement costs.
+    const exint numChunks = SYSmin(numPrims,
+        exint(UT_Thread::getNumProcessors()) * 4);
+    const exint chunkSize = (numPrims + numChunks - 1) / numChunks;
+
+    UT_Array<GU_DetailHandle> chunkDetails;
+    chunkDetails.setSize(numChunks);
+
+    std::atomic_bool workerInterrupt(false);
+    GusdErrorTransport errTransport;
+
+    UTparallelFor(UT_BlockedRange<exint>(0, numChunks),
+        [&](const UT_BlockedRange<exint> &r)
+        {
+            // Errors from getUsdPrim() and refinement are reported on the
+            // worker thread's error manager, so move them over to the
+            // calling thread when this task finishes.
+            GusdAutoErrorTransport autoErrTransport(errTransport);
+            GusdTfErrorScope tfErrorScope(UT_ERROR_WARNING);
+            auto* boss = UTgetInterrupt();
+
+            for (exint chunk = r.begin(); chunk < r.end(); ++chunk)
+            {
+                GU_Detail *chunkgdp = new GU_Detail;
+                chunkDetails(chunk).allocateAndSet(chunkgdp);
+
+                const exint start = chunk * chunkSize;
+                const exint end = SYSmin(start + chunkSize, numPrims);
+                for (exint i = start; i < end; ++i)
+                {
+                    if (boss->opInterrupt() || workerInterrupt)
+                        return;
+
+                    const GU_PrimPacked *pp = prims(i);
+                    if (!pp || pp->getTypeId() != typeId())
+                        continue;
+
+                    const GusdGU_PackedUSD *impl =
+                        static_cast<const GusdGU_PackedUSD *>(
+                            pp->implementation());
+
+                    UT_Matrix4D xform;
+                    pp->getFullTransform4(xform);
+
+                    const GA_Size numBefore = chunkgdp->getNumPrimitives();
+                    if (!impl->unpackGeometry(*chunkgdp,
+                            static_cast<const GU_Detail *>(&pp->getDetail()),
+                            pp->getMapOffset(),
+                            primvarPattern, translateSTtoUV,
+                            nonTransformingPrimvarPattern, &xform,
+                            refineParms))
+                    {
+                        workerInterrupt = true;
+                        return;
+                    }
+                    primCounts(i) =
+                        chunkgdp->getNumPrimitives() - numBefore;
+                }
+            }
+        });
+
+    if (task.wasInterrupted() || workerInterrupt)
+        return false;
+
+    UT_Array<GU_Detail *> gdps;
+    gdps.setCapacity(numChunks);
+    for (GU_DetailHandle &gdh : chunkDetails)
+    {
+        if (gdh.isValid() && (gdh.gdp()->getNumPoints() > 0 ||
+                              gdh.gdp()->getNumPrimitives() > 0))
+            gdps.append(gdh.gdpNC());
+    }
+
+    // The per-prim unpack records the constant attribute names on each
+    // chunk's detail. Gather them up front so the merge doesn't have to
+    // reconcile conflicting detail attribute values.
+    UT_StringHolder constant_attribs_pattern =
+        Gusd_AccumulateConstantAttribs(destgdp, gdps);
+
+    GUmatchAttributesAndMerge(destgdp, gdps);
+
+    if (constant_attribs_pattern.isstring())
+    {
+        GA_RWHandleS constant_attribs = destgdp.addStringTuple(
+            GA_ATTRIB_DETAIL, theConstantAttribsName.asHolder(), 1);
+        constant_attribs.set(GA_DETAIL_OFFSET, constant_attribs_pattern);
+    }
+
+    return !task.wasInterrupted();
+}
+
 bool
 GusdGU_PackedUSD::unpack(GU_Detail &destgdp, const UT_Matrix4D *transform) const
 {
@@ -252,6 +252,24 @@ public:
         const UT_Matrix4D* transform,
 	const GT_RefineParms *parms = nullptr) const;
 
+    /// Unpack many USD packed prims at once. The prims are refined in
+    /// parallel into per-task details, which are then merged into
+    /// @a destgdp with a single point and primitive allocation. The
+    /// unpacked primitives appear in @a destgdp in the same order as
+    /// @a prims, and @a primCounts receives the number of primitives
+    /// produced by each packed prim (zero for entries that are not USD
+    /// packed prims). If any prim fails to unpack, nothing is merged into
+    /// @a destgdp and false is returned. Errors reported while unpacking
+    /// are transported back to the calling thread's error manager.
+    static bool unpackGeometries(
+        GU_Detail &destgdp,
+        const UT_Array<const GU_PrimPacked *> &prims,
+        const char* primvarPattern,
+        bool translateSTtoUV,
+        const UT_StringRef& nonTransformingPrimvarPattern,
+        UT_Array<exint> &primCounts,
+        const GT_RefineParms *parms = nullptr);
+
     const UT_Matrix4D& getUsdTransform() const;
     
 private:
@@ -47,6 +47,8 @@
 #include <UT/UT_Interrupt.h>
 #include <UT/UT_ParallelUtil.h>
 
+#include <algorithm>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -879,41 +881,31 @@ GusdGU_USD::AppendExpandedPackedPrims(
     if (unpackToPolygons) {
         GA_Size gdStart = gd.getNumPrimitives();
 
-        // If unpacking down to polygons, iterate through the intermediate
-        // packed prims in gdPtr and unpack them into gd.
-        exint i = 0;
-        for (GA_Iterator it(primDstRng); !it.atEnd(); ++it, ++i) {
-            if(task.wasInterrupted()) {
-                return false;
-            }
-
+        // If unpacking down to polygons, gather the intermediate packed
+        // prims in gdPtr and unpack them into gd in one bulk pass. The
+        // prims are refined in parallel and merged into gd with a single
+        // allocation, rather than merging each prim's geometry separately.
+        UT_Array<const GU_PrimPacked*> packedPrims;
+        packedPrims.setCapacity(dstSize);
+        for (GA_Iterator it(primDstRng); !it.atEnd(); ++it) {
             const GEO_Primitive* p = gdPtr->getGEOPrimitive(*it);
-            if (p->getTypeId() != GusdGU_PackedUSD::typeId()) {
-                continue;
-            }
-
-            const GU_PrimPacked* pp = UTverify_cast<const GU_PrimPacked*>(p);
-            const GusdGU_PackedUSD* prim =
-                UTverify_cast<const GusdGU_PackedUSD*>(pp->implementation());
-
-            GA_Size gdCurrent = gd.getNumPrimitives();
-
-            UT_Matrix4D transform;
-            pp->getFullTransform4(transform);
+            packedPrims.append(
+                p->getTypeId() == GusdGU_PackedUSD::typeId() ?
+                UTverify_cast<const GU_PrimPacked*>(p) : nullptr);
+        }
 
-            // Unpack this prim.
-            if (!prim->unpackGeometry(gd,
-                static_cast<const GU_Detail*>(&pp->getDetail()),
-                pp->getMapOffset(),
-                primvarPattern.c_str(), translateSTtoUV,
-                nonTransformingPrimvarPattern, &transform)) {
-                return false;
-            }
+        UT_Array<exint> primCounts;
+        if (!GusdGU_PackedUSD::unpackGeometries(
+                gd, packedPrims, primvarPattern.c_str(), translateSTtoUV,
+                nonTransformingPrimvarPattern, primCounts)) {
+            delete gdPtr;
+            return false;
+        }
 
+        for (exint i = 0; i < primCounts.size(); ++i) {
             const GA_Offset offset =
                 indexToOffset(primIndexPairs(i).second);
-            const exint count = gd.getNumPrimitives() - gdCurrent;
-            for (exint j = 0; j < count; ++j) {
+            for (exint j = 0; j < primCounts(i); ++j) {
                 srcOffsets.append(offset);
             }
         }
@@ -1332,6 +1324,136 @@ private:
 };
 
 
+/** Evaluate GusdGU_PackedUSD::getUsdTransform() for the USD packed prims at
+    @a offsets. The transform (and the USD prim) are cached on the packed
+    implementation without any locking, and implementations may be shared
+    between prims, so each unique implementation is evaluated by a single
+    task before the parallel loops below read the cached transforms.*/
+void
+_CacheUsdTransforms(const GA_Detail& gd, const GA_OffsetArray& offsets)
+{
+    const GA_PrimitiveTypeId usdTypeId = GusdGU_PackedUSD::typeId();
+
+    UT_Array<const GusdGU_PackedUSD*> impls;
+    impls.setCapacity(offsets.size());
+    for(exint i = 0; i < offsets.size(); ++i) {
+        const GA_Primitive* p = gd.getPrimitive(offsets(i));
+        if(p->getTypeId() == usdTypeId) {
+            auto prim = UTverify_cast<const GU_PrimPacked*>(p);
+            impls.append(UTverify_cast<const GusdGU_PackedUSD*>(
+                prim->implementation()));
+        }
+    }
+    std::sort(impls.begin(), impls.end());
+    impls.setSize(std::unique(impls.begin(), impls.end()) - impls.begin());
+
+    UTparallelFor(UT_BlockedRange<exint>(0, impls.size()),
+        [&](const UT_BlockedRange<exint>& r)
+        {
+            for(exint i = r.begin(); i < r.end(); ++i) {
+                impls(i)->getUsdTransform();
+            }
+        });
+}
+
+
+/** Compute the Houdini-side transforms of USD packed prims.
+    Non-USD packed prims get an identity transform.*/
+struct _XformsFromPackedPrimsFn
+{
+    _XformsFromPackedPrimsFn(const GA_Detail& gd,
+                             const GA_OffsetArray& offsets,
+                             UT_Matrix4D* xforms)
+        : _gd(gd), _offsets(offsets), _xforms(xforms) {}
+
+    void    operator()(const UT_BlockedRange<size_t>& r) const
+            {
+                auto* boss = UTgetInterrupt();
+                char bcnt = 0;
+
+                const GA_PrimitiveTypeId usdTypeId =
+                    GusdGU_PackedUSD::typeId();
+
+                for(size_t i = r.begin(); i < r.end(); ++i) {
+                    if(ARCH_UNLIKELY(!++bcnt && boss->opInterrupt()))
+                        return;
+
+                    const GA_Primitive* p = _gd.getPrimitive(_offsets(i));
+                    if(p->getTypeId() != usdTypeId) {
+                        _xforms[i].identity();
+                        continue;
+                    }
+
+                    auto prim = UTverify_cast<const GU_PrimPacked*>(p);
+                    auto packedUSD = UTverify_cast<const GusdGU_PackedUSD*>(
+                        prim->implementation());
+
+                    // The transforms on a USD packed prim contains the
+                    // combination of the transform in the USD file and any
+                    // transform the user has applied in Houdini. Compute
+                    // just the transform that the user has applied in
+                    // Houdini.
+                    UT_Matrix4D primXform;
+                    prim->getFullTransform4(primXform);
+                    UT_Matrix4D invUsdXform = packedUSD->getUsdTransform();
+
+                    invUsdXform.invert();
+                    _xforms[i] = invUsdXform * primXform;
+                }
+            }
+private:
+    const GA_Detail&        _gd;
+    const GA_OffsetArray&   _offsets;
+    UT_Matrix4D* const      _xforms;
+};
+
+
+/** Apply Houdini-side transforms to USD packed prims, combining them
+    with the transform authored in USD.*/
+struct _SetPackedPrimXformsFn
+{
+    _SetPackedPrimXformsFn(GU_Detail& gd,
+                           const GA_OffsetArray& offsets,
+                           const UT_Matrix4D* xforms)
+        : _gd(gd), _offsets(offsets), _xforms(xforms) {}
+
+    void    operator()(const UT_BlockedRange<size_t>& r) const
+            {
+                auto* boss = UTgetInterrupt();
+                char bcnt = 0;
+
+                const GA_PrimitiveTypeId usdTypeId =
+                    GusdGU_PackedUSD::typeId();
+
+                for(size_t i = r.begin(); i < r.end(); ++i) {
+                    if(ARCH_UNLIKELY(!++bcnt && boss->opInterrupt()))
+                        return;
+
+                    GEO_Primitive* p = _gd.getGEOPrimitive(_offsets(i));
+                    if(p->getTypeId() != usdTypeId)
+                        continue;
+
+                    auto prim = UTverify_cast<GU_PrimPacked*>(p);
+                    auto packedUSD = UTverify_cast<const GusdGU_PackedUSD*>(
+                        prim->implementation());
+
+                    UT_Matrix4D m = packedUSD->getUsdTransform() * _xforms[i];
+
+                    UT_Matrix3D xform(m);
+                    UT_Vector3 pos;
+                    m.getTranslates(pos);
+
+                    prim->setLocalTransform(xform);
+                    prim->setPos3(0, pos);
+                }
+            }
+private:
+    GU_Detail&              _gd;
+    const GA_OffsetArray&   _offsets;
+    const UT_Matrix4D* const _xforms;
+};
+
+
 } /*namespace*/
 
 bool
@@ -1415,30 +1537,12 @@ GusdGU_USD::ComputeTransformsFromPackedPrims(const GA_Detail& gd,
                                              const GA_OffsetArray& offsets,
                                              UT_Matrix4D* xforms)
 {
-    for (exint i = 0; i < offsets.size(); ++i) {
-        const GA_Primitive* p = gd.getPrimitive(offsets(i));
-
-        if ( p->getTypeId() == GusdGU_PackedUSD::typeId() ) {
-            auto prim = UTverify_cast<const GU_PrimPacked*>(p);
-            auto packedUSD = UTverify_cast<const GusdGU_PackedUSD*>(prim->implementation());
-
-            // The transforms on a USD packed prim contains the combination
-            // of the transform in the USD file and any transform the user
-            // has applied in Houdini. Compute just the transform that the
-            // user has applied in Houdini.
+    UT_AutoInterrupt task("Computing transforms from packed prims");
 
-            UT_Matrix4D primXform;
-            prim->getFullTransform4(primXform);
-            UT_Matrix4D invUsdXform = packedUSD->getUsdTransform();
-
-            invUsdXform.invert();
-            xforms[i] = invUsdXform * primXform;
-
-        } else {
-            xforms[i].identity();
-        }
-    }
-    return true;
+    _CacheUsdTransforms(gd, offsets);
+    UTparallelForLightItems(UT_BlockedRange<size_t>(0, offsets.size()),
+                            _XformsFromPackedPrimsFn(gd, offsets, xforms));
+    return !task.wasInterrupted();
 }
 
 
@@ -1582,29 +1686,23 @@ GusdGU_USD::SetPackedPrimTransforms(GU_Detail& gd,
                                     const GA_Range& r,
                                     const UT_Matrix4D* xforms)
 {
-    exint i = 0;
-    for (GA_Iterator it(r); !it.atEnd(); ++it, ++i) {
-        GEO_Primitive* p = gd.getGEOPrimitive(*it);
-
-        if ( p->getTypeId() == GusdGU_PackedUSD::typeId() ) {
-            auto prim = UTverify_cast<GU_PrimPacked*>(p);
-            auto packedUSD = UTverify_cast<const GusdGU_PackedUSD*>(prim->implementation());
-
-            // The transforms on a USD packed prim contains the combination
-            // of the transform in the USD file and any transform the user
-            // has applied in Houdini. 
-
-            UT_Matrix4D m = packedUSD->getUsdTransform() * xforms[i];
-
-            UT_Matrix3D xform(m);
-            UT_Vector3 pos;
-            m.getTranslates(pos);
-
-            prim->setLocalTransform(xform);
-            prim->setPos3(0, pos);
-        }
-    }
-    return true;
+    UT_AutoInterrupt task("Setting packed prim transforms");
+
+    // Gather the range into an array up front so that each primitive keeps
+    // its index into the xforms array once the work is split up.
+    GA_OffsetArray offsets;
+    offsets.setCapacity(r.getEntries());
+    for (GA_Iterator it(r); !it.atEnd(); ++it)
+        offsets.append(*it);
+
+    // Writing P from multiple threads requires that no page be shared
+    // in constant form.
+    gd.getP()->hardenAllPages();
+
+    _CacheUsdTransforms(gd, offsets);
+    UTparallelForLightItems(UT_BlockedRange<size_t>(0, offsets.size()),
+                            _SetPackedPrimXformsFn(gd, offsets, xforms));
+    return !task.wasInterrupted();
 }
  
 
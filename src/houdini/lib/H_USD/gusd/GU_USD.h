@@ -63,6 +63,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 #define GUSD_WRITESTATICTOPOLOGY_ATTR  "usdwritestatictopology"
 #define GUSD_WRITESTATICPRIMVARS_ATTR  "usdwritestaticprimvars"
+#define GUSD_WRITEINDEXEDPRIMVARS_ATTR "usdwriteindexedprimvars"
 #define GUSD_WRITESTATICGEO_ATTR       "usdwritestaticgeo"
 /** @} */
 
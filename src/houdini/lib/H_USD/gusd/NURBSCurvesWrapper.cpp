@@ -717,8 +717,8 @@ GusdNURBSCurvesWrapper::updateFromGTPrim(
             GusdGT_AttrFilter::OwnerArgs owners;
             owners << GT_OWNER_VERTEX;
             filter.setActiveOwners(owners);
-            updatePrimvarFromGTPrim( 
-                vtxAttrs, filter, UsdGeomTokens->vertex, primvarTime );
+            updatePrimvarFromGTPrim( vtxAttrs, filter, UsdGeomTokens->vertex, primvarTime,
+                                     ctxt.writeIndexedPrimvars );
         }
         filter.appendPattern(GT_OWNER_CONSTANT, "^visible");
         if(const GT_AttributeListHandle constAttrs = sourcePrim->getDetailAttributes()) {
@@ -732,7 +732,8 @@ GusdNURBSCurvesWrapper::updateFromGTPrim(
             GusdGT_AttrFilter::OwnerArgs owners;
             owners << GT_OWNER_UNIFORM;
             filter.setActiveOwners(owners);
-            updatePrimvarFromGTPrim( uniformAttrs, filter, UsdGeomTokens->uniform, primvarTime );
+            updatePrimvarFromGTPrim( uniformAttrs, filter, UsdGeomTokens->uniform, primvarTime,
+                                     ctxt.writeIndexedPrimvars );
         }
 
         // If we have a "Cd" attribute, write it as both "Cd" and "displayColor".
@@ -25,14 +25,25 @@
 #include "gusd/USD_PropertyMap.h"
 #include "gusd/UT_Gf.h"
 
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/usd/usdGeom/xformable.h"
 
 #include <UT/UT_Matrix4.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+TF_DEFINE_ENV_SETTING(GUSD_CACHE_STATS_INTERVAL, 0,
+                      "If greater than zero, the usage statistics of all "
+                      "gusd data caches are printed at most once per this "
+                      "many seconds while the caches are in use.");
+
+
 GusdUSD_DataCache::GusdUSD_DataCache(GusdStageCache& cache)
     : _stageCache(cache)
 {
@@ -74,4 +85,87 @@ GusdUSD_DataCache::ShouldClearPrim(
 }
 
 
+void
+GusdUSD_DataCache::GetStats(GusdUSD_DataCacheStats& stats) const
+{
+    stats = GusdUSD_DataCacheStats();
+    stats.name = GetName();
+    stats.hits = _hits.relaxedLoad();
+    stats.misses = _misses.relaxedLoad();
+    stats.constructionTime = _constructNanos.relaxedLoad()*1e-9;
+    _AccumulateStats(stats);
+}
+
+
+void
+GusdUSD_DataCache::_AccumulateStats(const GusdUT_CappedCache& cache,
+                                    GusdUSD_DataCacheStats& stats)
+{
+    int64 entries = 0, bytes = 0;
+    cache.GetOccupancy(entries, bytes);
+
+    stats.hits += cache.GetHits();
+    stats.misses += cache.GetMisses();
+    stats.evictions += cache.GetEvictions();
+    stats.entries += entries;
+    stats.bytes += bytes;
+    stats.constructionTime += cache.GetConstructionTime();
+}
+
+
+void
+GusdUSD_DataCache::GetAllStats(UT_Array<GusdUSD_DataCacheStats>& stats)
+{
+    GusdStageCache::GetInstance().GetDataCacheStats(stats);
+}
+
+
+void
+GusdUSD_DataCache::DumpAllStats()
+{
+    UT_Array<GusdUSD_DataCacheStats> stats;
+    GetAllStats(stats);
+
+    for (const GusdUSD_DataCacheStats& s : stats) {
+        const int64 lookups = s.hits + s.misses;
+        printf("%s: hits=%lld misses=%lld hit_rate=%.1f%% evictions=%lld "
+               "entries=%lld bytes=%lld construction_time=%.3fs\n",
+               s.name.c_str(),
+               (long long)s.hits, (long long)s.misses,
+               lookups > 0 ? 100.0*s.hits/lookups : 0.0,
+               (long long)s.evictions, (long long)s.entries,
+               (long long)s.bytes, s.constructionTime);
+    }
+    fflush(stdout);
+}
+
+
+void
+GusdUSD_DataCache::_MaybeDumpStats()
+{
+    static const int interval = TfGetEnvSetting(GUSD_CACHE_STATS_INTERVAL);
+    if (interval <= 0) {
+        return;
+    }
+
+    using _Clock = std::chrono::steady_clock;
+    static std::atomic<_Clock::rep> nextDump(
+        (_Clock::now() + std::chrono::seconds(interval))
+        .time_since_epoch().count());
+
+    const _Clock::rep now = _Clock::now().time_since_epoch().count();
+    _Clock::rep next = nextDump.load(std::memory_order_relaxed);
+    if (now < next) {
+        return;
+    }
+    // Only the thread that advances the deadline writes the log.
+    const _Clock::rep advanced =
+        now + std::chrono::duration_cast<_Clock::duration>(
+            std::chrono::seconds(interval)).count();
+    if (nextDump.compare_exchange_strong(next, advanced)) {
+        DumpAllStats();
+    }
+}
+
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -26,10 +26,13 @@
 
 #include "gusd/api.h"
 #include "gusd/stageCache.h"
+#include "gusd/UT_CappedCache.h"
 
 #include "pxr/pxr.h"
 #include "pxr/base/tf/token.h"
 
+#include <SYS/SYS_AtomicInt.h>
+#include <UT/UT_StringHolder.h>
 #include <UT/UT_StringSet.h>
 
 
@@ -41,6 +44,20 @@ PXR_NAMESPACE_OPEN_SCOPE
 class GusdStageCache;
 
 
+/// Usage statistics reported by a GusdUSD_DataCache.
+struct GusdUSD_DataCacheStats
+{
+    UT_StringHolder name;
+    int64           hits = 0;
+    int64           misses = 0;
+    int64           evictions = 0;
+    int64           entries = 0;
+    int64           bytes = 0;
+    /// Time spent constructing cache items, in seconds.
+    double          constructionTime = 0;
+};
+
+
 class GUSD_API GusdUSD_DataCache
 {
 public:
@@ -62,8 +79,52 @@ public:
                         const UsdPrim& prim,
                         const UT_StringSet& stagesToClear);
 
+    /// Name used to identify this cache when reporting statistics.
+    virtual const char* GetName() const { return "GusdUSD_DataCache"; }
+
+    /// Compute the current usage statistics of this cache.
+    void            GetStats(GusdUSD_DataCacheStats& stats) const;
+
+    /// Gather the statistics of all data caches registered on the
+    /// default stage cache.
+    static void     GetAllStats(UT_Array<GusdUSD_DataCacheStats>& stats);
+
+    /// Print the statistics of all registered data caches to stdout.
+    static void     DumpAllStats();
+
+protected:
+    /// Add the statistics of the containers held by this cache to @a stats.
+    /// Implementations that don't use a GusdUT_CappedCache should record
+    /// their lookups with _RecordHit() and _RecordMiss().
+    virtual void    _AccumulateStats(GusdUSD_DataCacheStats& stats) const {}
+
+    /// Add the statistics of a capped cache to @a stats.
+    static void     _AccumulateStats(const GusdUT_CappedCache& cache,
+                                     GusdUSD_DataCacheStats& stats);
+
+    void            _RecordHit()
+                    {
+                        _hits.add(1);
+                        _MaybeDumpStats();
+                    }
+
+    void            _RecordMiss(double constructionTime=0)
+                    {
+                        _misses.add(1);
+                        _constructNanos.add(int64(constructionTime*1e9));
+                        _MaybeDumpStats();
+                    }
+
+    /// Periodically dump the statistics of all caches when the
+    /// GUSD_CACHE_STATS_INTERVAL environment variable is set to a
+    /// number of seconds.
+    static void     _MaybeDumpStats();
+
 protected:
     GusdStageCache& _stageCache;
+
+private:
+    SYS_AtomicInt64 _hits, _misses, _constructNanos;
 };
 
 
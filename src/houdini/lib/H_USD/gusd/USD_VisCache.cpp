@@ -28,6 +28,11 @@
 
 #include "pxr/base/arch/hints.h"
 
+#include <SYS/SYS_Math.h>
+
+#include <cmath>
+#include <limits>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 GusdUSD_VisCache::GusdUSD_VisCache(GusdStageCache& cache)
@@ -94,6 +99,40 @@ bool _QueryVisibility(const UsdAttributeQuery& query, UsdTimeCode time)
 }
 
 
+/** Return the interval of time over which the held visibility value
+    at @a time remains the same.*/
+GfInterval
+_GetHeldValueInterval(const UsdAttributeQuery& query, double time)
+{
+    static const double inf = std::numeric_limits<double>::infinity();
+
+    double lower = 0, upper = 0;
+    bool hasSamples = false;
+    if (!query.GetBracketingTimeSamples(time, &lower, &upper, &hasSamples) ||
+        !hasSamples) {
+        return GfInterval::GetFullInterval();
+    }
+
+    if (lower < upper) {
+        return GfInterval(lower, upper, true, false);
+    }
+    if (time < lower) {
+        // Before the first sample, which holds backwards.
+        return GfInterval(-inf, lower, false, true);
+    }
+    if (time == lower) {
+        // Exactly on a sample. Look just past it for the next one.
+        if (query.GetBracketingTimeSamples(std::nextafter(time, inf),
+                                           &lower, &upper, &hasSamples) &&
+            lower < upper) {
+            return GfInterval(time, upper, true, false);
+        }
+    }
+    // On or after the last sample, which holds forwards.
+    return GfInterval(SYSmin(time, lower), inf, true, false);
+}
+
+
 bool
 _ShouldCacheVisibility(int flags, UsdTimeCode time)
 {
@@ -108,9 +147,11 @@ _ShouldCacheVisibility(int flags, UsdTimeCode time)
 GusdUSD_VisCache::VisInfoHandle
 GusdUSD_VisCache::_GetVisInfo(const UsdPrim& prim)
 {
+    _MaybeDumpStats();
+
     _UnvaryingKey key((GusdUSD_UnvaryingPropertyKey(prim)));
 
-    if (UT_CappedItemHandle info = _visInfos.findItem(key)) {
+    if (UT_CappedItemHandle info = _visInfos.FindItem(key)) {
         return VisInfoHandle(UTverify_cast<VisInfo*>(info.get()));
     }
     // XXX: Potential race in construction, but in the worst case that will
@@ -136,7 +177,7 @@ GusdUSD_VisCache::_GetVisInfo(const UsdPrim& prim)
     }
     return VisInfoHandle(
         UTverify_cast<VisInfo*>(
-            _visInfos.addItem(
+            _visInfos.AddItem(
                 key, UT_CappedItemHandle(
                     new VisInfo(flags, visAttr))).get()));
 }
@@ -188,13 +229,25 @@ GusdUSD_VisCache::_GetVisibility(int& flags,
 bool
 GusdUSD_VisCache::GetResolvedVisibility(const UsdPrim& prim, UsdTimeCode time)
 {
+    GfInterval interval;
+    return _GetResolvedVisibility(prim, time, interval);
+}
+
+
+bool
+GusdUSD_VisCache::_GetResolvedVisibility(const UsdPrim& prim,
+                                         UsdTimeCode time,
+                                         GfInterval& interval)
+{
+    interval = GfInterval::GetFullInterval();
+
     auto info = _GetVisInfo(prim);
     if (ARCH_UNLIKELY(!info)) {
         return false;
     }
 
     int flags = info->flags.relaxedLoad();
-    if (_ShouldCacheVisibility(flags, time)) {
+    if (time.IsDefault() || !(flags&FLAGS_RESOLVED_ISMAYBETIMEVARYING)) {
         VisType visType = time.IsDefault() ?
             VIS_UNVARYING_RESOLVED : VIS_VARYING_RESOLVED;
         int stateFlags = _GetStateFlags(flags, visType);
@@ -217,25 +270,59 @@ GusdUSD_VisCache::GetResolvedVisibility(const UsdPrim& prim, UsdTimeCode time)
             info->flags.store(flags);
             return vis;
         }
-    } else {
-        // Visibility is not cached when time-varying.
-        if (_QueryVisibility(info->query, time)) {
-            if (UsdPrim parent = prim.GetParent()) {
-                if (!parent.IsPseudoRoot()) {
-                    return GetResolvedVisibility(parent, time);
-                }
+    }
+
+    // Time-varying resolved visibility. Reuse the last resolved value
+    // if it holds at this time.
+    const double t = time.GetValue();
+    {
+        UT_AutoLock lock(info->lock);
+        if (info->resolvedInterval.Contains(t)) {
+            interval = info->resolvedInterval;
+            return info->resolvedVis;
+        }
+    }
+
+    bool vis = true;
+    if (flags&FLAGS_ISMAYBETIMEVARYING) {
+        vis = _QueryVisibility(info->query, time);
+        interval = _GetHeldValueInterval(info->query, t);
+    } else if (_GetVisibility(flags, info->query, time, vis)) {
+        info->flags.store(flags);
+    }
+
+    // An invisible prim hides its descendants regardless of its ancestors,
+    // so the parent only matters if we're visible.
+    if (vis) {
+        if (UsdPrim parent = prim.GetParent()) {
+            if (!parent.IsPseudoRoot()) {
+                GfInterval parentInterval;
+                vis = _GetResolvedVisibility(parent, time, parentInterval);
+                interval &= parentInterval;
             }
-            return true;
         }
-        return false;
     }
+
+    {
+        UT_AutoLock lock(info->lock);
+        info->resolvedInterval = interval;
+        info->resolvedVis = vis;
+    }
+    return vis;
 }
 
 
 void
 GusdUSD_VisCache::Clear()
 {
-    _visInfos.clear();
+    _visInfos.Clear();
+}
+
+
+void
+GusdUSD_VisCache::_AccumulateStats(GusdUSD_DataCacheStats& stats) const
+{
+    GusdUSD_DataCache::_AccumulateStats(_visInfos, stats);
 }
 
 
@@ -30,17 +30,21 @@
 #include "gusd/UT_CappedCache.h"
 
 #include <SYS/SYS_AtomicInt.h>
+#include <UT/UT_Lock.h>
 
 #include "pxr/pxr.h"
+#include "pxr/base/gf/interval.h"
 #include "pxr/usd/usd/attributeQuery.h"
 #include "pxr/usd/usdGeom/imageable.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 /** Thread-safe, memory-capped visibility cache.
-    This does not cache varying visibility state; only unvarying visibility
-    values and information about whether or not visibility might vary
-    with time is cached.*/
+    Unvarying visibility values and information about whether or not
+    visibility might vary with time are cached. For time-varying resolved
+    visibility, each prim remembers the most recently resolved value along
+    with the time interval over which it holds, so lookups at other times
+    within that interval don't need to query the prim or its ancestors.*/
 class GusdUSD_VisCache final : public GusdUSD_DataCache
 {
 public:
@@ -67,6 +71,13 @@ public:
     GUSD_API
     virtual int64   Clear(const UT_StringSet& paths) override;
 
+    virtual const char* GetName() const override
+                        { return "GusdUSD_VisCache"; }
+
+protected:
+    virtual void    _AccumulateStats(
+                        GusdUSD_DataCacheStats& stats) const override;
+
 private:
     struct VisInfo : public UT_CappedItem
     {
@@ -79,11 +90,23 @@ private:
         
         SYS_AtomicInt32     flags;
         UsdAttributeQuery   query;
+
+        /// Time-varying resolved visibility, and the interval of time
+        /// over which that value holds. Guarded by @c lock.
+        UT_Lock             lock;
+        GfInterval          resolvedInterval;
+        bool                resolvedVis = true;
     };
     typedef UT_IntrusivePtr<VisInfo> VisInfoHandle;
 
     VisInfoHandle   _GetVisInfo(const UsdPrim& prim);
 
+    /** Compute resolved visibility, returning the interval of time
+        over which the result holds in @a interval.*/
+    bool            _GetResolvedVisibility(const UsdPrim& prim,
+                                           UsdTimeCode time,
+                                           GfInterval& interval);
+
     /** Query visibility. Returns true if @a flags were modified.*/
     bool            _GetVisibility(int& flags,
                                    const UsdAttributeQuery& query,
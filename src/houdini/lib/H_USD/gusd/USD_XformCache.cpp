@@ -58,6 +58,65 @@ struct _CappedXformItem : public UT_CappedItem
 
 typedef UT_IntrusivePtr<const _CappedXformItem> _CappedXformItemHandle;
 
+
+/** Key for the transforms of a prim over a set of sample times.*/
+struct _XformSamplesKey
+{
+    _XformSamplesKey() : hash(0) {}
+
+    _XformSamplesKey(const UsdPrim& prim, const UT_Array<UsdTimeCode>& times)
+        : prim(prim)
+        , times(times)
+        , hash(ComputeHash(prim, times)) {}
+
+    static std::size_t  ComputeHash(const UsdPrim& prim,
+                                    const UT_Array<UsdTimeCode>& times)
+                        {
+                            std::size_t h = SYShash(prim);
+                            for(const auto& time : times)
+                                SYShashCombine(h, time);
+                            return h;
+                        }
+
+    bool                operator==(const _XformSamplesKey& o) const
+                        { return prim == o.prim && times == o.times; }
+
+    struct HashCmp
+    {
+        static std::size_t  hash(const _XformSamplesKey& key)
+                            { return key.hash; }
+        static bool         equal(const _XformSamplesKey& a,
+                                  const _XformSamplesKey& b)
+                            { return a == b; }
+    };
+
+    UsdPrim                 prim;
+    UT_Array<UsdTimeCode>   times;
+    std::size_t             hash;
+};
+
+typedef GusdUT_CappedKey<_XformSamplesKey,
+                         _XformSamplesKey::HashCmp> _SamplesKey;
+
+
+struct _CappedXformSamplesItem : public UT_CappedItem
+{
+    _CappedXformSamplesItem(const UT_Matrix4D* xforms, exint count)
+        : UT_CappedItem()
+    {
+        this->xforms.setSizeNoInit(count);
+        for(exint i = 0; i < count; ++i)
+            this->xforms[i] = xforms[i];
+    }
+
+    virtual ~_CappedXformSamplesItem() {}
+
+    virtual int64   getMemoryUsage() const
+                    { return sizeof(*this) + xforms.getMemoryUsage(false); }
+
+    UT_Array<UT_Matrix4D>   xforms;
+};
+
 } /*namespace*/
 
 void
@@ -104,16 +163,18 @@ GusdUSD_XformCache::GetXformInfo(const UsdPrim& prim)
         return nullptr;
     }
 
+    _MaybeDumpStats();
+
     _UnvaryingKey key((GusdUSD_UnvaryingPropertyKey(prim)));
 
-    if(auto item = _xformInfos.findItem(key))
+    if(auto item = _xformInfos.FindItem(key))
         return XformInfoHandle(UTverify_cast<XformInfo*>(item.get()));
 
     auto* info = new XformInfo(UsdGeomXformable(prim));
     info->ComputeFlags(prim, *this);
     auto item = UT_CappedItemHandle(info);
     return XformInfoHandle(UTverify_cast<XformInfo*>(
-                               _xformInfos.addItem(key,item).get()));
+                               _xformInfos.AddItem(key,item).get()));
 }
 
 
@@ -145,7 +206,7 @@ GusdUSD_XformCache::_GetLocalTransformation(const UsdPrim& prim,
     }
     _VaryingKey key(GusdUSD_VaryingPropertyKey(prim, time));
 
-    if(auto item = _xforms.findItem(key)) {
+    if(auto item = _xforms.FindItem(key)) {
         xform = UTverify_cast<const _CappedXformItem*>(item.get())->xform;
         return true;
     }
@@ -153,7 +214,7 @@ GusdUSD_XformCache::_GetLocalTransformation(const UsdPrim& prim,
        but it's preferable to have multiple threads compute the
        same thing than to cause lock contention.*/
     if(info->query.GetLocalTransformation(GusdUT_Gf::Cast(&xform), time)) {
-        _xforms.addItem(key, UT_CappedItemHandle(new _CappedXformItem(xform)));
+        _xforms.AddItem(key, UT_CappedItemHandle(new _CappedXformItem(xform)));
         return true;
     }
     return false;
@@ -180,7 +241,7 @@ GusdUSD_XformCache::GetLocalToWorldTransform(const UsdPrim& prim,
     }
     _VaryingKey key(GusdUSD_VaryingPropertyKey(prim, time));
 
-    if(auto item = _worldXforms.findItem(key)) {
+    if(auto item = _worldXforms.FindItem(key)) {
         xform = UTverify_cast<const _CappedXformItem*>(item.get())->xform;
         return true;
     }
@@ -189,7 +250,7 @@ GusdUSD_XformCache::GetLocalToWorldTransform(const UsdPrim& prim,
        same thing than to cause lock contention.*/
     if(_GetLocalTransformation(prim, time, xform, info)) {
         if(ARCH_UNLIKELY(!info->HasParentXform())) {
-            _worldXforms.addItem(key, UT_CappedItemHandle(
+            _worldXforms.AddItem(key, UT_CappedItemHandle(
                                      new _CappedXformItem(xform)));
             return true;
         }
@@ -199,7 +260,7 @@ GusdUSD_XformCache::GetLocalToWorldTransform(const UsdPrim& prim,
         UT_Matrix4D parentXf;
         if(GetLocalToWorldTransform(parent, time, parentXf)) {
             xform *= parentXf;
-            _worldXforms.addItem(
+            _worldXforms.AddItem(
                 key, UT_CappedItemHandle(new _CappedXformItem(xform)));
             return true;
         }
@@ -209,11 +270,88 @@ GusdUSD_XformCache::GetLocalToWorldTransform(const UsdPrim& prim,
 
 
 
+bool
+GusdUSD_XformCache::GetLocalToWorldTransformSamples(
+    const UsdPrim& prim,
+    const UT_Array<UsdTimeCode>& times,
+    UT_Matrix4D* xforms)
+{
+    const exint numTimes = times.size();
+    if(ARCH_UNLIKELY(numTimes == 0)) {
+        return true;
+    }
+
+    const auto info = GetXformInfo(prim);
+    if(ARCH_UNLIKELY(!info)) {
+        return false;
+    }
+
+    // Nothing to sample if neither this prim nor its ancestors vary.
+    if(!info->WorldXformIsMaybeTimeVarying()) {
+        if(!GetLocalToWorldTransform(prim, times(0), xforms[0])) {
+            return false;
+        }
+        for(exint i = 1; i < numTimes; ++i)
+            xforms[i] = xforms[0];
+        return true;
+    }
+
+    _SamplesKey key(_XformSamplesKey(prim, times));
+
+    if(auto item = _worldXformSamples.FindItem(key)) {
+        const auto& samples =
+            UTverify_cast<const _CappedXformSamplesItem*>(item.get())->xforms;
+        for(exint i = 0; i < numTimes; ++i)
+            xforms[i] = samples(i);
+        return true;
+    }
+
+    // Local transforms, evaluated once if they don't vary.
+    if(info->LocalXformIsMaybeTimeVarying()) {
+        for(exint i = 0; i < numTimes; ++i) {
+            if(!info->query.GetLocalTransformation(
+                   GusdUT_Gf::Cast(xforms + i), times(i))) {
+                return false;
+            }
+        }
+    } else {
+        if(!_GetLocalTransformation(prim, times(0), xforms[0], info)) {
+            return false;
+        }
+        for(exint i = 1; i < numTimes; ++i)
+            xforms[i] = xforms[0];
+    }
+
+    if(info->HasParentXform()) {
+        const UsdPrim parent = prim.GetParent();
+        UT_ASSERT_P(parent);
+
+        UT_Array<UT_Matrix4D> parentXfs;
+        parentXfs.setSizeNoInit(numTimes);
+        if(!GetLocalToWorldTransformSamples(parent, times,
+                                            parentXfs.array())) {
+            return false;
+        }
+        for(exint i = 0; i < numTimes; ++i)
+            xforms[i] *= parentXfs(i);
+    }
+
+    /* XXX: As with single samples, a race is possible when setting the
+       computed value, which is preferable to lock contention.*/
+    _worldXformSamples.AddItem(key, UT_CappedItemHandle(
+                                   new _CappedXformSamplesItem(xforms,
+                                                               numTimes)));
+    return true;
+}
+
+
+
 GusdUSD_XformCache::GusdUSD_XformCache(GusdStageCache& cache)
     : GusdUSD_DataCache(cache),
       _xforms(GUSDUT_USDCACHE_NAME, 512),
       _worldXforms(GUSDUT_USDCACHE_NAME, 512),
-      _xformInfos(GUSDUT_USDCACHE_NAME, 256) {}
+      _xformInfos(GUSDUT_USDCACHE_NAME, 256),
+      _worldXformSamples(GUSDUT_USDCACHE_NAME, 512) {}
 
     
 GusdUSD_XformCache::GusdUSD_XformCache()
@@ -334,6 +472,63 @@ GusdUSD_XformCache::GetLocalToWorldTransforms(
 namespace {
 
 
+/** Functor for computing transform samples from USD prims.*/
+struct _ComputeXformSamplesFn
+{
+    _ComputeXformSamplesFn(GusdUSD_XformCache& cache,
+                           const UT_Array<UsdPrim>& prims,
+                           const UT_Array<UsdTimeCode>& times,
+                           UT_Matrix4D* xforms)
+        : _cache(cache), _prims(prims), _times(times), _xforms(xforms) {}
+
+    void    operator()(const UT_BlockedRange<size_t>& r) const
+            {
+                auto* boss = UTgetInterrupt();
+                char bcnt = 0;
+
+                const exint numTimes = _times.size();
+
+                for(size_t i = r.begin(); i < r.end(); ++i) {
+                    if(!++bcnt && boss->opInterrupt())
+                        return;
+
+                    UT_Matrix4D* xfs = _xforms + i*numTimes;
+                    if(UsdPrim prim = _prims(i)) {
+                        if(_cache.GetLocalToWorldTransformSamples(
+                               prim, _times, xfs))
+                            continue;
+                    }
+                    for(exint j = 0; j < numTimes; ++j)
+                        xfs[j].identity();
+                }
+            }
+
+private:
+    GusdUSD_XformCache&             _cache;
+    const UT_Array<UsdPrim>&        _prims;
+    const UT_Array<UsdTimeCode>&    _times;
+    UT_Matrix4D* const              _xforms;
+};
+
+
+} /*namespace*/
+
+
+bool
+GusdUSD_XformCache::GetLocalToWorldTransformSamples(
+    const UT_Array<UsdPrim>& prims,
+    const UT_Array<UsdTimeCode>& times,
+    UT_Matrix4D* xforms)
+{
+    UTparallelFor(UT_BlockedRange<size_t>(0, prims.size()),
+                  _ComputeXformSamplesFn(*this, prims, times, xforms));
+    return !UTgetInterrupt()->opInterrupt();
+}
+
+
+namespace {
+
+
 template <typename NameFn>
 struct _QueryConstraintsT
 {
@@ -435,9 +630,20 @@ GusdUSD_XformCache::GetConstraintTransforms(
 void
 GusdUSD_XformCache::Clear()
 {
-    _xforms.clear();
-    _worldXforms.clear();
-    _xformInfos.clear();
+    _xforms.Clear();
+    _worldXforms.Clear();
+    _xformInfos.Clear();
+    _worldXformSamples.Clear();
+}
+
+
+void
+GusdUSD_XformCache::_AccumulateStats(GusdUSD_DataCacheStats& stats) const
+{
+    GusdUSD_DataCache::_AccumulateStats(_xforms, stats);
+    GusdUSD_DataCache::_AccumulateStats(_worldXforms, stats);
+    GusdUSD_DataCache::_AccumulateStats(_xformInfos, stats);
+    GusdUSD_DataCache::_AccumulateStats(_worldXformSamples, stats);
 }
 
 
@@ -467,7 +673,8 @@ GusdUSD_XformCache::Clear(const UT_StringSet& paths)
 {   
     return _RemoveKeysT<_VaryingKey>(paths, _xforms) +
            _RemoveKeysT<_VaryingKey>(paths, _worldXforms ) +
-           _RemoveKeysT<_UnvaryingKey>(paths, _xformInfos);
+           _RemoveKeysT<_UnvaryingKey>(paths, _xformInfos) +
+           _RemoveKeysT<_SamplesKey>(paths, _worldXformSamples);
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -69,6 +69,24 @@ public:
                 const GusdDefaultArray<UsdTimeCode>& times,
                 UT_Matrix4D* xforms);
 
+    /** Compute world transforms of a prim over a whole set of sample
+        times (eg., shutter open/close) in a single pass. The xform query
+        and the parent's samples are shared by all times, and the results
+        are cached together for the prim.
+        @a xforms must have room for one matrix per sample time.*/
+    bool    GetLocalToWorldTransformSamples(
+                const UsdPrim& prim,
+                const UT_Array<UsdTimeCode>& times,
+                UT_Matrix4D* xforms);
+
+    /** Compute world transform samples for multiple prims in parallel.
+        The samples of each prim are stored contiguously, so the sample
+        for time @c j of prim @c i is at <tt>xforms[i*times.size()+j]</tt>.*/
+    bool    GetLocalToWorldTransformSamples(
+                const UT_Array<UsdPrim>& prims,
+                const UT_Array<UsdTimeCode>& times,
+                UT_Matrix4D* xforms);
+
     /* Compute constraint transforms given a common constraint name
        for all prims. Constraint transforms not cached.*/
     bool    GetConstraintTransforms(
@@ -130,6 +148,13 @@ public:
     GUSD_API
     virtual int64   Clear(const UT_StringSet& paths) override;
 
+    virtual const char* GetName() const override
+                        { return "GusdUSD_XformCache"; }
+
+protected:
+    virtual void    _AccumulateStats(
+                        GusdUSD_DataCacheStats& stats) const override;
+
 private:
     bool    _GetLocalTransformation(const UsdPrim& prim,
                                     UsdTimeCode time,
@@ -140,6 +165,7 @@ private:
 
 private:
     GusdUT_CappedCache  _xforms, _worldXforms, _xformInfos;
+    GusdUT_CappedCache  _worldXformSamples;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
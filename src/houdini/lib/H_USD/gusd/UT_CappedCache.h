@@ -31,11 +31,14 @@
 #include "pxr/pxr.h"
 
 #include <SYS/SYS_AtomicInt.h>
+#include <SYS/SYS_Math.h>
 #include <UT/UT_Assert.h>
 #include <UT/UT_CappedCache.h>
 #include <UT/UT_ConcurrentHashMap.h>
 #include <UT/UT_IntrusivePtr.h>
 
+#include <chrono>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /** Convenience wrapper around UT_CappedKey.
@@ -104,6 +107,77 @@ public:
     
     template <typename MatchFn>
     int64                       ClearEntries(const MatchFn& matchFn);
+
+    /// Variants of findItem()/addItem()/clear() that also update the
+    /// usage statistics of the cache. Lookups made through Find() and
+    /// FindOrCreate() are always recorded.
+    /// @{
+    UT_CappedItemHandle         FindItem(const UT_CappedKey& key)
+                                {
+                                    UT_CappedItemHandle item = findItem(key);
+                                    (item ? _hits : _misses).add(1);
+                                    return item;
+                                }
+
+    UT_CappedItemHandle         AddItem(const UT_CappedKey& key,
+                                        const UT_CappedItemHandle& item)
+                                {
+                                    UT_CappedItemHandle added =
+                                        addItem(key, item);
+                                    if(added == item) {
+                                        _inserts.add(1);
+                                    }
+                                    return added;
+                                }
+
+    void                        Clear()
+                                {
+                                    // Everything still held by the cache
+                                    // counts as removed, not evicted.
+                                    const int64 entries =
+                                        _GetCurrentEntries();
+                                    clear();
+                                    _removed.add(entries);
+                                }
+    /// @}
+
+    /// \name Statistics
+    /// Counters are only updated through the methods of this class, not
+    /// through the underlying UT_CappedCache interface. They are running
+    /// totals, so reading them never has to traverse the cache.
+    /// @{
+    int64                       GetHits() const
+                                { return _hits.relaxedLoad(); }
+
+    int64                       GetMisses() const
+                                { return _misses.relaxedLoad(); }
+
+    /// Number of items dropped by the cache to stay within its memory cap.
+    /// UT_CappedCache doesn't report the items it prunes, but every other
+    /// insertion and removal goes through this class, so any inserted item
+    /// that was neither removed nor is still held must have been evicted.
+    int64                       GetEvictions() const
+                                {
+                                    return SYSmax(int64(0),
+                                                  _inserts.relaxedLoad() -
+                                                  _removed.relaxedLoad() -
+                                                  _GetCurrentEntries());
+                                }
+
+    /// Total time spent in FindOrCreate() constructing items, in seconds.
+    double                      GetConstructionTime() const
+                                {
+                                    return _constructNanos.relaxedLoad()*1e-9;
+                                }
+
+    /// Number of items currently held in the cache, and their memory usage.
+    void                        GetOccupancy(int64& entries,
+                                             int64& bytes) const
+                                {
+                                    entries = _GetCurrentEntries();
+                                    bytes = _GetCurrentBytes();
+                                }
+    /// @}
     
 private:
 
@@ -121,6 +195,16 @@ private:
                                  UT_CappedItemHandle,
                                  _HashCompare>  _ConstructMap;
     _ConstructMap   _constructMap;
+
+    int64           _GetCurrentBytes() const
+                    { return const_cast<GusdUT_CappedCache*>(this)->
+                        utGetCurrentSize(); }
+
+    int64           _GetCurrentEntries() const
+                    { return const_cast<GusdUT_CappedCache*>(this)->
+                        entries(); }
+
+    SYS_AtomicInt64 _hits, _misses, _inserts, _removed, _constructNanos;
 };
 
 
@@ -128,7 +212,7 @@ template <typename Item>
 UT_IntrusivePtr<const Item>
 GusdUT_CappedCache::Find(const UT_CappedKey& key)
 {
-    if(UT_CappedItemHandle hnd = findItem(key))
+    if(UT_CappedItemHandle hnd = FindItem(key))
         return UT_IntrusivePtr<const Item>(
             UTverify_cast<const Item*>(hnd.get()));
     return UT_IntrusivePtr<const Item>();
@@ -151,8 +235,13 @@ GusdUT_CappedCache::FindOrCreate(const UT_CappedKey& key,
         // Make sure another thread didn't beat us to it.
         a->second = findItem(key);
         if(!a->second) {
-            if((a->second = creator(args...))) {
-                addItem(key, a->second);
+            const auto start = std::chrono::steady_clock::now();
+            a->second = creator(args...);
+            _constructNanos.add(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+            if(a->second) {
+                AddItem(key, a->second);
             } else {
                 _constructMap.erase(a);
                 return UT_IntrusivePtr<const Item>();
@@ -175,7 +264,9 @@ GusdUT_CappedCache::ClearEntries(const MatchFn& matchFn)
                         const UT_CappedItemHandle& item)
         {
             if(matchFn(key, item)) {
-                freed += item->getMemoryUsage();
+                const int64 itemBytes = item->getMemoryUsage();
+                freed += itemBytes;
+                _removed.add(1);
                 // XXX: deleteItem() is safe in threadSafeTraversal!
                 this->deleteItem(*key);
             }
@@ -94,14 +94,27 @@ GusdBoundsCache::_ComputeBound(
 	    : prim.GetStage()->GetRootLayer()->GetRealPath() );
 
     MapType::accessor accessor;
+    bool hit = true;
     if( !m_map.find( accessor, Key( stageId, includedPurposes ))) {
         m_map.insert( accessor, Key( stageId, includedPurposes ) );
         accessor->second = new Item( time, includedPurposes );
+        hit = false;
     }
     std::lock_guard<std::mutex> lock(accessor->second->lock);
     UsdGeomBBoxCache& cache = accessor->second->bboxCache;
 
-    cache.SetTime( time );
+    // Changing the time flushes the bounds held by the UsdGeomBBoxCache.
+    if( cache.GetTime() != time ) {
+        cache.SetTime( time );
+        hit = false;
+    }
+
+    // A lookup is a hit when it reuses a UsdGeomBBoxCache holding bounds
+    // for the requested time.
+    if( hit )
+        _RecordHit();
+    else
+        _RecordMiss();
 
     // boundFunc is either ComputeWorldBound or ComputeLocalBound
     GfBBox3d primBBox = (cache.*boundFunc)(prim);
@@ -124,6 +137,15 @@ GusdBoundsCache::_ComputeBound(
     return false;
 }
 
+void
+GusdBoundsCache::_AccumulateStats(GusdUSD_DataCacheStats& stats) const
+{
+    // Entries are never evicted, and the memory held by each
+    // UsdGeomBBoxCache is not exposed, so only the items are counted.
+    stats.entries += m_map.size();
+    stats.bytes += m_map.size() * (sizeof(Key) + sizeof(Item));
+}
+
 void
 GusdBoundsCache::Clear()
 {
@@ -35,6 +35,8 @@
 #include <UT/UT_IntrusivePtr.h>
 #include <UT/UT_ConcurrentHashMap.h>
 
+#include <mutex>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /// A wrapper arround UsdGeomBBoxCache. 
@@ -68,6 +70,12 @@ public:
     virtual void Clear() override;
     virtual int64 Clear(const UT_StringSet& stageNames) override;
 
+    virtual const char* GetName() const override { return "GusdBoundsCache"; }
+
+protected:
+    virtual void _AccumulateStats(
+            GusdUSD_DataCacheStats& stats) const override;
+
 private:
 
     // Key that hashes the stage file name and a set of purposes.
@@ -30,6 +30,8 @@
 #include "pxr/usd/usd/stage.h"
 #include "pxr/usd/usdGeom/tokens.h"
 
+#include "writeCtrlFlags.h"
+
 #include <GT/GT_Primitive.h>
 
 #include <functional>
@@ -61,11 +63,25 @@ public:
         , writeStaticGeo( false )
         , writeStaticTopology( false )
         , writeStaticPrimvars( false )
+        , writeIndexedPrimvars( false )
         , attributeFilter( af )
         , purpose( UsdGeomTokens->default_ )
         , makeRefsInstanceable( true )
     {}
 
+    // Copy the flags that may be overridden by primitive attributes from
+    // a set of write control flags.
+    void setWriteCtrlFlags( const GusdWriteCtrlFlags &flags ) {
+        overlayPoints = flags.overPoints;
+        overlayTransforms = flags.overTransforms;
+        overlayPrimvars = flags.overPrimvars;
+        overlayAll = flags.overAll;
+        writeStaticGeo = flags.writeStaticGeo;
+        writeStaticTopology = flags.writeStaticTopology;
+        writeStaticPrimvars = flags.writeStaticPrimvars;
+        writeIndexedPrimvars = flags.writeIndexedPrimvars;
+    }
+
     // Time of the current frame we are writing
     UsdTimeCode time;
 
@@ -86,6 +102,10 @@ public:
     bool writeStaticTopology;
     bool writeStaticPrimvars;
 
+    // Write string primvars as indexed primvars, storing each unique value
+    // once, rather than flattening them.
+    bool writeIndexedPrimvars;
+
     // Filter specifying what primvars to write for each prim.
     const GusdGT_AttrFilter& attributeFilter;
 
@@ -850,7 +850,8 @@ updateFromGTPrim(const GT_PrimitiveHandle&  sourcePrim,
             GusdGT_AttrFilter::OwnerArgs owners;
             owners << GT_OWNER_VERTEX;
             filter.setActiveOwners(owners);
-            updatePrimvarFromGTPrim( vtxAttrs, filter, UsdGeomTokens->vertex, primvarTime );
+            updatePrimvarFromGTPrim( vtxAttrs, filter, UsdGeomTokens->vertex, primvarTime,
+                                     ctxt.writeIndexedPrimvars );
         }
         if(const GT_AttributeListHandle constAttrs = sourcePrim->getDetailAttributes()) {
             GusdGT_AttrFilter::OwnerArgs owners;
@@ -862,7 +863,8 @@ updateFromGTPrim(const GT_PrimitiveHandle&  sourcePrim,
             GusdGT_AttrFilter::OwnerArgs owners;
             owners << GT_OWNER_UNIFORM;
             filter.setActiveOwners(owners);
-            updatePrimvarFromGTPrim( uniformAttrs, filter, UsdGeomTokens->uniform, primvarTime );
+            updatePrimvarFromGTPrim( uniformAttrs, filter, UsdGeomTokens->uniform, primvarTime,
+                                     ctxt.writeIndexedPrimvars );
         }
 
         // If we have a "Cd" attribute, write it as both "Cd" and "displayColor".
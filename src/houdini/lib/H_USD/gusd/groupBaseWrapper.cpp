@@ -233,7 +233,8 @@ GusdGroupBaseWrapper::updateGroupFromGTPrim(
             GusdGT_AttrFilter::OwnerArgs owners;
             owners << GT_OWNER_UNIFORM;
             filter.setActiveOwners(owners);
-            updatePrimvarFromGTPrim( uniformAttrs, filter, UsdGeomTokens->uniform, ctxt.time );
+            updatePrimvarFromGTPrim( uniformAttrs, filter, UsdGeomTokens->uniform, ctxt.time,
+                                     ctxt.writeIndexedPrimvars );
         }
     }
 
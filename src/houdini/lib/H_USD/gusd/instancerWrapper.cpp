@@ -1140,7 +1140,8 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
             GusdGT_AttrFilter::OwnerArgs owners;
             owners << GT_OWNER_POINT;
             filter.setActiveOwners(owners);
-            updatePrimvarFromGTPrim( pointAttrs, filter, UsdGeomTokens->uniform, ctxt.time );
+            updatePrimvarFromGTPrim( pointAttrs, filter, UsdGeomTokens->uniform, ctxt.time,
+                                     ctxt.writeIndexedPrimvars );
         }
         if(const GT_AttributeListHandle constAttrs = sourcePrim->getDetailAttributes()) {
 
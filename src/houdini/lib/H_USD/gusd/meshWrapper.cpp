@@ -1408,7 +1408,8 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
             GusdGT_AttrFilter::OwnerArgs owners;
             owners << GT_OWNER_POINT;
             filter.setActiveOwners(owners);
-            updatePrimvarFromGTPrim( pointAttrs, filter, UsdGeomTokens->vertex, primvarTime );
+            updatePrimvarFromGTPrim( pointAttrs, filter, UsdGeomTokens->vertex, primvarTime,
+                                     ctxt.writeIndexedPrimvars );
         }
         if(GT_AttributeListHandle vertexAttrs = sourcePrim->getVertexAttributes()) {
             GusdGT_AttrFilter::OwnerArgs owners;
@@ -1421,7 +1422,8 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
                 vertexAttrs = vertexAttrs->createIndirect(vertexIndirect); 
             }           
 
-            updatePrimvarFromGTPrim( vertexAttrs, filter, UsdGeomTokens->faceVarying, primvarTime );
+            updatePrimvarFromGTPrim( vertexAttrs, filter, UsdGeomTokens->faceVarying, primvarTime,
+                                     ctxt.writeIndexedPrimvars );
         }
 
         if(const GT_AttributeListHandle primAttrs = sourcePrim->getUniformAttributes()) {
@@ -1457,7 +1459,8 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
                     GT_OWNER_UNIFORM, 
                     interpolation,
                     primvarTime, 
-                    data );
+                    data,
+                    ctxt.writeIndexedPrimvars );
             }
         }
 
@@ -518,6 +518,48 @@ GusdPrimWrapper::updateTransformFromGTPrim( const GfMatrix4d &xform,
     }
 }
 
+void
+GusdPrimWrapper::AttrLastValueEntry::setData( const GT_DataArrayHandle &data )
+{
+    entries = data->entries();
+    storage = data->getStorage();
+    tupleSize = data->getTupleSize();
+    hash = data->hashRange( 0, entries );
+}
+
+bool
+GusdPrimWrapper::AttrLastValueEntry::matches(
+    const GT_DataArrayHandle &data ) const
+{
+    if( data->entries() != entries ||
+        data->getStorage() != storage ||
+        data->getTupleSize() != tupleSize ) {
+        return false;
+    }
+
+    // Data ids aren't unique across arrays (indirect arrays and arrays
+    // from a different topology can share them), so always compare the
+    // contents.
+    return data->hashRange( 0, entries ) == hash;
+}
+
+namespace {
+
+// Write the value authored at lastSet again at lastCompared, so that the
+// value holds until just before the next sample that we write.
+void
+_writeHeldSample( const UsdAttribute& attr,
+                  UsdTimeCode lastSet,
+                  UsdTimeCode lastCompared )
+{
+    VtValue held;
+    if( attr && attr.Get( &held, lastSet )) {
+        attr.Set( held, lastCompared );
+    }
+}
+
+} // anon namespace
+
 bool
 GusdPrimWrapper::updateAttributeFromGTPrim( 
     GT_Owner owner, 
@@ -539,14 +581,14 @@ GusdPrimWrapper::updateAttributeFromGTPrim(
 
         // Set the value for the first time
         m_lastAttrValueDict.emplace(
-            key, AttrLastValueEntry( time, houAttr->harden()));
+            key, AttrLastValueEntry( time, houAttr ));
 
         GusdGT_Utils::setUsdAttribute(usdAttr, houAttr, time);
         return true;
     } 
     else {
         AttrLastValueEntry& entry = it->second;
-        if( houAttr->isEqual( *entry.data )) {
+        if( entry.matches( houAttr )) {
 
             // The value are the as before. Don't set.
             entry.lastCompared = time;
@@ -555,14 +597,14 @@ GusdPrimWrapper::updateAttributeFromGTPrim(
         else {
             if( entry.lastCompared != entry.lastSet ) {
                 // Set a value on the last frame the previous value was valid.
-                GusdGT_Utils::setUsdAttribute(usdAttr, entry.data, entry.lastCompared);
+                _writeHeldSample( usdAttr, entry.lastSet, entry.lastCompared );
             }
             
             // set the new value
             GusdGT_Utils::setUsdAttribute(usdAttr, houAttr, time);
 
-            // save this value to compare on later frames
-            entry.data = houAttr->harden();
+            // save a signature of this value to compare on later frames
+            entry.setData( houAttr );
             entry.lastSet = entry.lastCompared = time;
             return true;
         }
@@ -576,7 +618,8 @@ GusdPrimWrapper::updatePrimvarFromGTPrim(
     const GT_Owner&           owner,
     const TfToken&            interpolation,
     UsdTimeCode               time,
-    const GT_DataArrayHandle& dataIn )
+    const GT_DataArrayHandle& dataIn,
+    bool                      indexed )
 {
     GT_DataArrayHandle data = dataIn;
     UsdGeomImageable prim( getUsdPrim() );
@@ -585,44 +628,65 @@ GusdPrimWrapper::updatePrimvarFromGTPrim(
     //         << prim.GetPrim().GetPath() << ":" << name << ", " << interpolation 
     //         << ", entries = " << dataIn->entries() << endl;
 
+    const bool writeIndexed = indexed &&
+        GusdGT_Utils::canWriteIndexedPrimvar( prim, name, data, interpolation );
+
     AttrLastValueKeyType key(owner, name);
     auto it = m_lastAttrValueDict.find( key );
     if( it == m_lastAttrValueDict.end() ) {
 
         // If we're creating an overlay this primvar might already be
         // authored on the prim. If the primvar is indexed we need to 
-        // block the indices attribute, because we flatten indexed
-        // primvars.
-        if( UsdGeomPrimvar primvar = prim.GetPrimvar(name) ) {
-            if( primvar.IsIndexed() ) {
-                primvar.BlockIndices();
+        // block the indices attribute, unless we are writing indices
+        // ourselves, because otherwise we flatten indexed primvars.
+        if( !writeIndexed ) {
+            if( UsdGeomPrimvar primvar = prim.GetPrimvar(name) ) {
+                if( primvar.IsIndexed() ) {
+                    primvar.BlockIndices();
+                }
             }
         }
 
         m_lastAttrValueDict.emplace(
-            key, AttrLastValueEntry( time, data->harden()));
+            key, AttrLastValueEntry( time, data ));
 
-        GusdGT_Utils::setPrimvarSample( prim, name, data, interpolation, time );
+        if( writeIndexed ) {
+            GusdGT_Utils::setIndexedPrimvarSample(
+                prim, name, data, interpolation, time );
+        } else {
+            GusdGT_Utils::setPrimvarSample(
+                prim, name, data, interpolation, time );
+        }
     }
     else {
         AttrLastValueEntry& entry = it->second;
-        if( data->isEqual( *entry.data )) {
+        if( entry.matches( data )) {
             entry.lastCompared = time;
             return false;
         }
         else {
-            if( entry.lastCompared != entry.lastSet ) {
-                GusdGT_Utils::setPrimvarSample( prim, name, entry.data, interpolation, entry.lastCompared );
+            UsdGeomPrimvar primvar = prim.GetPrimvar(name);
+
+            if( entry.lastCompared != entry.lastSet && primvar ) {
+                _writeHeldSample( primvar.GetAttr(),
+                                  entry.lastSet, entry.lastCompared );
+                if( primvar.IsIndexed() ) {
+                    _writeHeldSample( primvar.GetIndicesAttr(),
+                                      entry.lastSet, entry.lastCompared );
+                }
             }
             
-             if( UsdGeomPrimvar primvar = prim.GetPrimvar(name) ) {
-                if( primvar.IsIndexed() ) {
+            if( writeIndexed ) {
+                GusdGT_Utils::setIndexedPrimvarSample(
+                    prim, name, data, interpolation, time );
+            } else {
+                if( primvar && primvar.IsIndexed() ) {
                     primvar.BlockIndices();
                 }
+                GusdGT_Utils::setPrimvarSample(
+                    prim, name, data, interpolation, time );
             }
-
-            GusdGT_Utils::setPrimvarSample( prim, name, data, interpolation, time );
-            entry.data = data->harden();
+            entry.setData( data );
             entry.lastSet = entry.lastCompared = time;
             return true;
         }
@@ -635,7 +699,8 @@ GusdPrimWrapper::updatePrimvarFromGTPrim(
     const GT_AttributeListHandle& gtAttrs,
     const GusdGT_AttrFilter&      primvarFilter,
     const TfToken&                interpolation,
-    UsdTimeCode                   time )
+    UsdTimeCode                   time,
+    bool                          indexed )
 {
     UsdGeomImageable prim( getUsdPrim() );
     const GT_AttributeMapHandle attrMapHandle = gtAttrs->getMap();
@@ -662,7 +727,8 @@ GusdPrimWrapper::updatePrimvarFromGTPrim(
                     owner, 
                     interpolation, 
                     time, 
-                    attrData );
+                    attrData,
+                    indexed );
     }
     return true;
 }
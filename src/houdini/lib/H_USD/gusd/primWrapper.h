@@ -25,6 +25,7 @@
 #define __GUSD_PRIMWRAPPER_H__
 
 #include <GT/GT_Primitive.h>
+#include <SYS/SYS_Hash.h>
 #include <UT/UT_ConcurrentHashMap.h>
 
 #include "gusd/api.h"
@@ -279,18 +280,23 @@ protected:
                                     UsdAttribute& usdAttr, 
                                     UsdTimeCode time );
 
+    /// Write a primvar value to USD. If @a indexed is true, primvars that
+    /// support it (see GusdGT_Utils::canWriteIndexedPrimvar) are written
+    /// as indexed primvars rather than being flattened.
     bool updatePrimvarFromGTPrim( 
                 const TfToken&              name,
                 const GT_Owner&             owner,
                 const TfToken&              interpolation,
                 UsdTimeCode                 time,
-                const GT_DataArrayHandle&   data );
+                const GT_DataArrayHandle&   data,
+                bool                        indexed = false );
 
     /// Write primvar values from a GT attribute list to USD.
     bool updatePrimvarFromGTPrim( const GT_AttributeListHandle& gtAttrs,
                                   const GusdGT_AttrFilter&      primvarFilter,
                                   const TfToken&                interpolation,
-                                  UsdTimeCode                   time );
+                                  UsdTimeCode                   time,
+                                  bool                          indexed = false );
 
     void clearCaches();
 
@@ -325,15 +331,26 @@ protected:
     //////////////
     // Support from collapsing attribute values across frames
 
+    // Rather than holding on to a copy of the last value written, we keep
+    // a signature of it that is cheap to compare against new data. The
+    // value itself can be read back from USD when a held sample needs to
+    // be written.
     struct AttrLastValueEntry {
 
-        AttrLastValueEntry( const UsdTimeCode &time, GT_DataArrayHandle data_ ) {
-            data = data_;
+        AttrLastValueEntry( const UsdTimeCode &time,
+                            const GT_DataArrayHandle &data ) {
+            setData( data );
             lastSet = time;
             lastCompared = time;
         }
 
-        GT_DataArrayHandle  data;
+        void setData( const GT_DataArrayHandle &data );
+        bool matches( const GT_DataArrayHandle &data ) const;
+
+        SYS_HashType        hash;
+        GT_Size             entries;
+        GT_Storage          storage;
+        int                 tupleSize;
         UsdTimeCode         lastSet;
         UsdTimeCode         lastCompared;
     };
@@ -422,6 +422,15 @@ public:
                             _dataCaches.removeIndex(idx);
                     }
 
+    void            GetDataCacheStats(
+                        UT_Array<GusdUSD_DataCacheStats>& stats)
+                    {
+                        UT_AutoLock lock(_dataCacheLock);
+                        stats.setSize(_dataCaches.size());
+                        for(exint i = 0; i < _dataCaches.size(); ++i)
+                            _dataCaches[i]->GetStats(stats[i]);
+                    }
+
     void            FindStages(const UT_StringSet& paths,
                                UT_Set<UsdStageRefPtr>& stages) const;
 
@@ -1698,6 +1707,13 @@ GusdStageCache::RemoveDataCache(GusdUSD_DataCache& cache)
 }
 
 
+void
+GusdStageCache::GetDataCacheStats(UT_Array<GusdUSD_DataCacheStats>& stats)
+{
+    _impl->GetDataCacheStats(stats);
+}
+
+
 GusdStageCacheReader::GusdStageCacheReader(GusdStageCache& cache, bool writer)
     : _cache(cache), _writer(writer)
 {
@@ -46,6 +46,7 @@ class UT_StringSet;
 PXR_NAMESPACE_OPEN_SCOPE
 
 class GusdUSD_DataCache;
+struct GusdUSD_DataCacheStats;
 class UsdPrim;
 
 /// Cache for USD stages.
@@ -71,6 +72,9 @@ public:
     void    AddDataCache(GusdUSD_DataCache& cache);
 
     void    RemoveDataCache(GusdUSD_DataCache& cache);
+
+    /// Gather the usage statistics of all registered data caches.
+    void    GetDataCacheStats(UT_Array<GusdUSD_DataCacheStats>& stats);
     /// @}
 
     /// \section GusdStageCache_Reloading Reloading
@@ -22,6 +22,7 @@
 // language governing permissions and limitations under the Apache License.
 //
 #include "gusd/stageCache.h"
+#include "gusd/USD_DataCache.h"
 
 #include "pxr/base/tf/makePyConstructor.h"
 #include "pxr/base/tf/pyResultConversions.h"
@@ -210,6 +211,28 @@ _ReloadStages(GusdStageCache& self, const list& paths)
 }
 
 
+list
+_GetDataCacheStats(GusdStageCache& self)
+{
+    UT_Array<GusdUSD_DataCacheStats> stats;
+    self.GetDataCacheStats(stats);
+
+    list statsList;
+    for(const auto& s : stats) {
+        dict d;
+        d["name"] = s.name.toStdString();
+        d["hits"] = s.hits;
+        d["misses"] = s.misses;
+        d["evictions"] = s.evictions;
+        d["entries"] = s.entries;
+        d["bytes"] = s.bytes;
+        d["constructionTime"] = s.constructionTime;
+        statsList.append(d);
+    }
+    return statsList;
+}
+
+
 void wrapGusdStageCache()
 {
     using This = GusdStageCache;
@@ -257,5 +280,7 @@ void wrapGusdStageCache()
         .def("FindStages", &_FindStages, (arg("paths")))
 
         .def("ReloadStages", &_ReloadStages, (arg("paths")))
+
+        .def("GetDataCacheStats", &_GetDataCacheStats)
         ;
 }
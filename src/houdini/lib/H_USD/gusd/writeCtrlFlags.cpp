@@ -41,6 +41,7 @@ GusdWriteCtrlFlags::update( const GT_PrimitiveHandle &sourcePrim )
     writeStaticGeo = getBoolAttr( sourcePrim, GUSD_WRITESTATICGEO_ATTR, writeStaticGeo );
     writeStaticTopology = getBoolAttr( sourcePrim, GUSD_WRITESTATICTOPOLOGY_ATTR, writeStaticTopology );
     writeStaticPrimvars = getBoolAttr( sourcePrim, GUSD_WRITESTATICPRIMVARS_ATTR, writeStaticPrimvars );
+    writeIndexedPrimvars = getBoolAttr( sourcePrim, GUSD_WRITEINDEXEDPRIMVARS_ATTR, writeIndexedPrimvars );
 }
 
 /* static */
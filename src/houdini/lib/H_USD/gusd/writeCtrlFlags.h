@@ -50,6 +50,7 @@ struct GusdWriteCtrlFlags {
     bool writeStaticGeo;
     bool writeStaticTopology;
     bool writeStaticPrimvars;
+    bool writeIndexedPrimvars;
 
     GusdWriteCtrlFlags() 
         : overPoints( false )
@@ -59,6 +60,7 @@ struct GusdWriteCtrlFlags {
         , writeStaticGeo( false )
         , writeStaticTopology( false )
         , writeStaticPrimvars( false )
+        , writeIndexedPrimvars( false )
     {}
 
     // Update flags with values read from prims attributes.